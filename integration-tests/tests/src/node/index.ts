@@ -32,3 +32,4 @@ import "./sync-proxy";
 import "./custom-inspect";
 import "./ssl";
 import "./node-fetch";
+import "./startup-performance";
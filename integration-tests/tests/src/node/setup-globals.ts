@@ -19,7 +19,7 @@
 /* eslint-disable no-restricted-globals */
 
 import { inspect } from "node:util";
-import { existsSync } from "node:fs";
+import { existsSync, readFileSync, writeFileSync } from "node:fs";
 import { dirname, resolve } from "node:path";
 import v8 from "node:v8";
 import vm from "node:vm";
@@ -34,6 +34,12 @@ Object.assign(globalThis, {
     exists(path: string) {
       return existsSync(path);
     },
+    readFile(path: string) {
+      return readFileSync(path, "utf8");
+    },
+    writeFile(path: string, contents: string) {
+      writeFileSync(path, contents, "utf8");
+    },
   },
   path: {
     dirname(path: string) {
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { execFile } from "node:child_process";
+import fs from "node:fs";
+import module from "node:module";
+import os from "node:os";
+import path from "node:path";
+import { promisify } from "node:util";
+
+import { itPerformsMeasured } from "../utils/benchmark";
+
+const require = module.createRequire(import.meta.url);
+const realmPackagePath = require.resolve("realm");
+
+const execFileAsync = promisify(execFile);
+
+/**
+ * Runs the source in a new Node.js process and resolves to the number of milliseconds it printed.
+ */
+async function measureInNewProcess(source: string): Promise<number> {
+  const cwd = fs.mkdtempSync(path.join(os.tmpdir(), "realm-startup-test-"));
+  const { stdout } = await execFileAsync(process.execPath, ["--eval", source], {
+    cwd,
+    env: { REALM_PACKAGE_PATH: realmPackagePath },
+  }).finally(() => fs.rmSync(cwd, { recursive: true, force: true }));
+  const duration = Number(stdout.trim());
+  if (Number.isNaN(duration)) {
+    throw new Error(`Expected a duration, got '${stdout}'`);
+  }
+  return duration;
+}
+
+describe.skipIf(environment.performance !== true, "Startup performance", () => {
+  itPerformsMeasured(
+    "loads the package",
+    () =>
+      measureInNewProcess(`
+        const start = performance.now();
+        require(process.env.REALM_PACKAGE_PATH);
+        console.log(performance.now() - start);
+      `),
+    { iter: 20, warmup: 2, size: 1 },
+  );
+
+  itPerformsMeasured(
+    "loads the package and writes to an in-memory Realm",
+    () =>
+      measureInNewProcess(`
+        const start = performance.now();
+        const Realm = require(process.env.REALM_PACKAGE_PATH);
+        const realm = new Realm({ inMemory: true, schema: [{ name: "Item", properties: { name: "string" } }] });
+        realm.write(() => realm.create("Item", { name: "first" }));
+        realm.objects("Item")[0].name;
+        realm.close();
+        console.log(performance.now() - start);
+        Realm.shutdown();
+      `),
+    { iter: 20, warmup: 2, size: 1 },
+  );
+});
@@ -16,4 +16,15 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+import { reportBenchmarks } from "./utils/benchmark";
+
+import "./performance-tests/collections";
+import "./performance-tests/host-objects";
+import "./performance-tests/mixed";
+import "./performance-tests/notifications";
+import "./performance-tests/open";
 import "./performance-tests/property-reads";
+import "./performance-tests/queries";
+import "./performance-tests/writes";
+
+after("report benchmarks", reportBenchmarks);
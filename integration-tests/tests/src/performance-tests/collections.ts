@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const AuthorSchema: ObjectSchema = {
+  name: "Author",
+  properties: {
+    name: "string",
+  },
+};
+
+const BookSchema: ObjectSchema = {
+  name: "Book",
+  properties: {
+    title: "string",
+    pages: "int",
+    published: "date",
+    author: "Author?",
+    tags: "string[]",
+  },
+};
+
+const ShelfSchema: ObjectSchema = {
+  name: "Shelf",
+  properties: {
+    books: "Book[]",
+  },
+};
+
+const OBJECT_COUNT = 10000;
+const JSON_OBJECT_COUNT = 1000;
+
+type Book = { title: string; pages: number; published: Date; author: { name: string } | null; tags: string[] };
+type Shelf = { books: Realm.List<Book> };
+
+describe.skipIf(environment.performance !== true, "Collection performance", () => {
+  openRealmBefore({ schema: [AuthorSchema, BookSchema, ShelfSchema] });
+
+  before(function (this: RealmContext) {
+    // Override toJSON to prevent this being serialized by Mocha Remote
+    Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+    this.realm.write(() => {
+      const author = this.realm.create(AuthorSchema.name, { name: "Douglas Adams" });
+      const shelf = this.realm.create<Shelf>(ShelfSchema.name, {});
+      for (let i = 0; i < OBJECT_COUNT; i++) {
+        const book = this.realm.create<Book>(BookSchema.name, {
+          title: `Book #${i}`,
+          pages: i,
+          published: new Date(i),
+          author,
+          tags: ["fiction", "classic"],
+        });
+        if (i < JSON_OBJECT_COUNT) {
+          shelf.books.push(book);
+        }
+      }
+    });
+  });
+
+  itPerforms(
+    `iterates ${OBJECT_COUNT} results`,
+    function (this: RealmContext) {
+      let pages = 0;
+      for (const book of this.realm.objects<Book>(BookSchema.name)) {
+        pages += book.pages;
+      }
+      if (pages === 0) {
+        throw new Error("Expected pages");
+      }
+    },
+    { iter: 20, warmup: 2, size: OBJECT_COUNT },
+  );
+
+  itPerforms(
+    `indexes ${OBJECT_COUNT} results`,
+    function (this: RealmContext) {
+      const books = this.realm.objects<Book>(BookSchema.name);
+      let pages = 0;
+      for (let i = 0; i < books.length; i++) {
+        pages += books[i].pages;
+      }
+      if (pages === 0) {
+        throw new Error("Expected pages");
+      }
+    },
+    { iter: 20, warmup: 2, size: OBJECT_COUNT },
+  );
+
+  itPerforms(
+    `maps ${OBJECT_COUNT} results`,
+    function (this: RealmContext) {
+      const titles = this.realm.objects<Book>(BookSchema.name).map((book) => book.title);
+      if (titles.length !== OBJECT_COUNT) {
+        throw new Error("Expected titles");
+      }
+    },
+    { iter: 20, warmup: 2, size: OBJECT_COUNT },
+  );
+
+  itPerforms(
+    `iterates a list of ${JSON_OBJECT_COUNT} objects`,
+    function (this: RealmContext) {
+      const [shelf] = this.realm.objects<Shelf>(ShelfSchema.name);
+      let pages = 0;
+      for (const book of shelf.books) {
+        pages += book.pages;
+      }
+      if (pages === 0) {
+        throw new Error("Expected pages");
+      }
+    },
+    { iter: 100, warmup: 5, size: JSON_OBJECT_COUNT },
+  );
+
+  itPerforms(
+    "serializes an object with toJSON()",
+    function (this: RealmContext) {
+      const [book] = this.realm.objects<Book>(BookSchema.name);
+      if (!book.toJSON()) {
+        throw new Error("Expected JSON");
+      }
+    },
+    { iter: 1000, size: 1 },
+  );
+
+  itPerforms(
+    `serializes a list of ${JSON_OBJECT_COUNT} objects with toJSON()`,
+    function (this: RealmContext) {
+      const [shelf] = this.realm.objects<Shelf>(ShelfSchema.name);
+      if (shelf.books.toJSON().length !== JSON_OBJECT_COUNT) {
+        throw new Error("Expected JSON");
+      }
+    },
+    { iter: 20, warmup: 2, size: JSON_OBJECT_COUNT },
+  );
+
+  itPerforms(
+    `stringifies a list of ${JSON_OBJECT_COUNT} objects with JSON.stringify()`,
+    function (this: RealmContext) {
+      const [shelf] = this.realm.objects<Shelf>(ShelfSchema.name);
+      if (!JSON.stringify(shelf.books)) {
+        throw new Error("Expected JSON");
+      }
+    },
+    { iter: 20, warmup: 2, size: JSON_OBJECT_COUNT },
+  );
+});
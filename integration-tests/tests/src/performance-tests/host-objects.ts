@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const ItemSchema: ObjectSchema = {
+  name: "Item",
+  primaryKey: "_id",
+  properties: {
+    _id: "int",
+    name: "string",
+    price: "double",
+    quantity: "int",
+    available: "bool",
+    weight: "float?",
+  },
+};
+
+type Item = { _id: number; name: string; price: number; quantity: number; available: boolean; weight?: number };
+
+/**
+ * Compares property access with and without `Realm.flags.OBJECT_HOST_FAST_PATH`.
+ * The fast path is only implemented by the JSI binding, so on Node.js both variants measure the same thing.
+ */
+describe.skipIf(environment.performance !== true, "Host object performance", () => {
+  for (const fastPath of [false, true]) {
+    describe(fastPath ? "with host object fast path" : "without host object fast path", () => {
+      const suffix = fastPath ? " (host object)" : "";
+      let previous = false;
+
+      before(() => {
+        previous = Realm.flags.OBJECT_HOST_FAST_PATH;
+        Realm.flags.OBJECT_HOST_FAST_PATH = fastPath;
+      });
+
+      after(() => {
+        Realm.flags.OBJECT_HOST_FAST_PATH = previous;
+      });
+
+      openRealmBefore({ schema: [ItemSchema] });
+
+      before(function (this: Partial<RealmObjectContext<Item>> & RealmContext) {
+        // Override toJSON to prevent this being serialized by Mocha Remote
+        Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+        this.object = this.realm.write(() =>
+          this.realm.create<Item>(ItemSchema.name, {
+            _id: 1,
+            name: "Widget",
+            price: 9.99,
+            quantity: 42,
+            available: true,
+            weight: 1.5,
+          }),
+        );
+        Object.defineProperty(this.object, "toJSON", { value: () => ({}) });
+      });
+
+      itPerforms(
+        `reads a string property${suffix}`,
+        function (this: RealmObjectContext<Item>) {
+          if (typeof this.object.name !== "string") {
+            throw new Error("Expected a string");
+          }
+        },
+        { iter: 10000, size: 1 },
+      );
+
+      itPerforms(
+        `reads all properties${suffix}`,
+        function (this: RealmObjectContext<Item>) {
+          const { _id, name, price, quantity, available, weight } = this.object;
+          // Performing a check to avoid the reads to be optimized away.
+          if (_id + name.length + price + quantity + Number(available) + (weight ?? 0) < 0) {
+            throw new Error("Unexpected values");
+          }
+        },
+        { iter: 10000, size: 6 },
+      );
+
+      itPerforms(
+        `writes an int property${suffix}`,
+        function (this: RealmObjectContext<Item>) {
+          this.realm.write(() => {
+            this.object.quantity += 1;
+          });
+        },
+        { iter: 200, size: 1 },
+      );
+    });
+  }
+});
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { BSON, ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const MixedSchema: ObjectSchema = {
+  name: "MixedHolder",
+  properties: {
+    value: "mixed",
+  },
+};
+
+type MixedHolder = { value: Realm.Mixed };
+
+const NESTED_VALUE = {
+  name: "nested",
+  numbers: [1, 2, 3, 4, 5],
+  flags: { a: true, b: false },
+  children: [
+    { name: "first", tags: ["x", "y"] },
+    { name: "second", tags: [] },
+  ],
+};
+
+const cases: [string, Realm.Mixed][] = [
+  ["null", null],
+  ["bool", true],
+  ["int", 123],
+  ["double", 123.456],
+  ["string", "Hello!"],
+  ["date", new Date("2000-01-01")],
+  ["data", new Uint8Array([0x00, 0x01, 0x02, 0x03])],
+  ["decimal128", new BSON.Decimal128("123")],
+  ["objectId", new BSON.ObjectId("0000002a9a7969d24bea4cf4")],
+  ["uuid", new BSON.UUID()],
+  ["list", [1, "two", 3.5, null]],
+  ["dictionary", { one: 1, two: "two", three: 3.5 }],
+  ["nested collections", NESTED_VALUE],
+];
+
+describe.skipIf(environment.performance !== true, "Mixed performance", () => {
+  for (const [typeName, value] of cases) {
+    describe(`mixed holding ${typeName}`, () => {
+      openRealmBefore({ schema: [MixedSchema] });
+
+      before(function (this: Partial<RealmObjectContext<MixedHolder>> & RealmContext) {
+        // Override toJSON to prevent this being serialized by Mocha Remote
+        Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+        this.object = this.realm.write(() => this.realm.create<MixedHolder>(MixedSchema.name, { value }));
+        Object.defineProperty(this.object, "toJSON", { value: () => ({}) });
+      });
+
+      itPerforms(
+        `reads ${typeName}`,
+        function (this: RealmObjectContext<MixedHolder>) {
+          const value = this.object.value;
+          // Performing a check to avoid the get of the property to be optimized away.
+          if (typeof value === "undefined") {
+            throw new Error("Expected a value");
+          }
+        },
+        { iter: 1000, size: 1 },
+      );
+
+      itPerforms(
+        `writes ${typeName}`,
+        function (this: RealmObjectContext<MixedHolder>) {
+          this.realm.write(() => {
+            this.object.value = value;
+          });
+        },
+        { iter: 200, size: 1 },
+      );
+    });
+  }
+});
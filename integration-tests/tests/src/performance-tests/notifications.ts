@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { CollectionChangeSet, ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerformsAsync } from "../utils/benchmark";
+import { PromiseHandle, createPromiseHandle } from "../utils/promise-handle";
+
+const ItemSchema: ObjectSchema = {
+  name: "Item",
+  properties: {
+    name: "string",
+    count: "int",
+  },
+};
+
+const CHANGESET_SIZE = 10000;
+
+type Item = { name: string; count: number };
+
+type NotificationsContext = {
+  items: Realm.Results<Realm.Object<Item> & Item>;
+  changes: PromiseHandle<CollectionChangeSet>;
+  listener: (collection: unknown, changes: CollectionChangeSet) => void;
+} & RealmContext &
+  Mocha.Context;
+
+describe.skipIf(environment.performance !== true, "Notification performance", () => {
+  openRealmBefore({ schema: [ItemSchema] });
+
+  before(async function (this: NotificationsContext) {
+    // Override toJSON to prevent this being serialized by Mocha Remote
+    Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+    this.items = this.realm.objects<Item>(ItemSchema.name);
+    this.changes = createPromiseHandle();
+    this.listener = (_, changes) => this.changes.resolve(changes);
+    this.items.addListener(this.listener);
+    // Wait for the initial notification
+    await this.changes;
+  });
+
+  after(function (this: NotificationsContext) {
+    this.items.removeListener(this.listener);
+  });
+
+  function expectChanges(changes: CollectionChangeSet, key: keyof CollectionChangeSet) {
+    if (changes[key].length !== CHANGESET_SIZE) {
+      throw new Error(`Expected ${CHANGESET_SIZE} ${key}, got ${changes[key].length}`);
+    }
+  }
+
+  itPerformsAsync(
+    `delivers ${CHANGESET_SIZE} insertions`,
+    function (this: NotificationsContext) {
+      this.changes = createPromiseHandle();
+    },
+    async function (this: NotificationsContext) {
+      this.realm.write(() => {
+        for (let i = 0; i < CHANGESET_SIZE; i++) {
+          this.realm.create(ItemSchema.name, { name: `item-${i}`, count: 0 });
+        }
+      });
+      expectChanges(await this.changes, "insertions");
+    },
+    { iter: 5, warmup: 1, size: CHANGESET_SIZE },
+  );
+
+  itPerformsAsync(
+    `delivers ${CHANGESET_SIZE} modifications`,
+    function (this: NotificationsContext) {
+      this.changes = createPromiseHandle();
+    },
+    async function (this: NotificationsContext) {
+      this.realm.write(() => {
+        // Only touching the last objects, as the collection has grown by the previous test
+        for (const item of this.items.slice(-CHANGESET_SIZE)) {
+          item.count++;
+        }
+      });
+      expectChanges(await this.changes, "newModifications");
+    },
+    { iter: 10, warmup: 1, size: CHANGESET_SIZE },
+  );
+
+  itPerformsAsync(
+    `delivers ${CHANGESET_SIZE} deletions`,
+    function (this: NotificationsContext) {
+      // Create the objects to delete without measuring it
+      this.realm.write(() => {
+        for (let i = 0; i < CHANGESET_SIZE; i++) {
+          this.realm.create(ItemSchema.name, { name: `item-${i}`, count: 0 });
+        }
+      });
+      return new Promise<void>((resolve) => {
+        this.changes = createPromiseHandle();
+        this.changes.then(() => {
+          this.changes = createPromiseHandle();
+          resolve();
+        });
+      });
+    },
+    async function (this: NotificationsContext) {
+      this.realm.write(() => {
+        this.realm.delete(this.items.slice(-CHANGESET_SIZE));
+      });
+      expectChanges(await this.changes, "deletions");
+    },
+    { iter: 5, warmup: 1, size: CHANGESET_SIZE },
+  );
+});
@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { ObjectSchema, PropertiesTypes } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const PROPERTY_TYPES = ["bool", "int", "double", "string", "date", "data", "objectId", "uuid", "mixed", "int[]"];
+
+function createSchema(classCount: number, propertyCount: number): ObjectSchema[] {
+  const schema: ObjectSchema[] = [];
+  for (let c = 0; c < classCount; c++) {
+    const properties: PropertiesTypes = {};
+    for (let p = 0; p < propertyCount; p++) {
+      properties[`prop${p}`] = PROPERTY_TYPES[p % PROPERTY_TYPES.length];
+    }
+    // Link each class to the next to include relationships in the schema
+    properties.link = `Class${(c + 1) % classCount}?`;
+    schema.push({ name: `Class${c}`, properties });
+  }
+  return schema;
+}
+
+type OpenContext = { config: Realm.Configuration } & RealmContext;
+
+describe.skipIf(environment.performance !== true, "Open performance", () => {
+  for (const [classCount, propertyCount] of [
+    [1, 10],
+    [100, 20],
+    [500, 20],
+  ]) {
+    describe(`schema with ${classCount} classes of ${propertyCount} properties`, () => {
+      const schema = createSchema(classCount, propertyCount);
+      openRealmBefore({ schema });
+
+      before(async function (this: OpenContext) {
+        this.config = { path: this.realm.path, schema };
+        // Close the Realm to ensure every iteration opens it from scratch
+        await this.closeRealm({ deleteFile: false, clearTestState: true });
+      });
+
+      itPerforms(
+        "opens an existing Realm",
+        function (this: OpenContext) {
+          new Realm(this.config).close();
+        },
+        { iter: 50, warmup: 5, size: 1 },
+      );
+
+      itPerforms(
+        "opens an existing Realm with an unchanged schema fingerprint",
+        function (this: OpenContext) {
+          // The first (warmup) iteration stores the fingerprint
+          new Realm({ ...this.config, schemaFingerprint: true }).close();
+        },
+        { iter: 50, warmup: 5, size: 1 },
+      );
+
+      itPerforms(
+        "opens an existing Realm without passing a schema",
+        function (this: OpenContext) {
+          new Realm({ path: this.config.path }).close();
+        },
+        { iter: 50, warmup: 5, size: 1 },
+      );
+    });
+  }
+});
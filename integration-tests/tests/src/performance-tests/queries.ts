@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const ItemSchema: ObjectSchema = {
+  name: "Item",
+  properties: {
+    name: "string",
+    indexedName: { type: "string", indexed: true },
+    count: "int",
+    score: "double",
+  },
+};
+
+const OBJECT_COUNT = 10000;
+
+function expectNonEmpty(value: unknown) {
+  // Performing a check to avoid the result to be optimized away.
+  if (typeof value === "undefined") {
+    throw new Error("Expected a value");
+  }
+}
+
+describe.skipIf(environment.performance !== true, "Query performance", () => {
+  openRealmBefore({ schema: [ItemSchema] });
+
+  before(function (this: RealmContext) {
+    // Override toJSON to prevent this being serialized by Mocha Remote
+    Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+    this.realm.write(() => {
+      for (let i = 0; i < OBJECT_COUNT; i++) {
+        const name = `item-${i}`;
+        this.realm.create(ItemSchema.name, { name, indexedName: name, count: i % 100, score: Math.random() });
+      }
+    });
+  });
+
+  itPerforms(
+    "filters on an int",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).filtered("count > 50").length);
+    },
+    { iter: 200, size: 1 },
+  );
+
+  itPerforms(
+    "filters on a string",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).filtered("name BEGINSWITH 'item-1'").length);
+    },
+    { iter: 200, size: 1 },
+  );
+
+  itPerforms(
+    "filters on an indexed string",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).filtered("indexedName == $0", "item-5000")[0]);
+    },
+    { iter: 1000, size: 1 },
+  );
+
+  itPerforms(
+    "filters with a compound predicate",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).filtered("count > 10 AND score < 0.5").length);
+    },
+    { iter: 200, size: 1 },
+  );
+
+  itPerforms(
+    "sorts by a double",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).sorted("score")[0]);
+    },
+    { iter: 100, size: 1 },
+  );
+
+  itPerforms(
+    "sorts by a string, descending",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).sorted("name", true)[0]);
+    },
+    { iter: 100, size: 1 },
+  );
+
+  itPerforms(
+    "filters and sorts",
+    function (this: RealmContext) {
+      expectNonEmpty(this.realm.objects(ItemSchema.name).filtered("count < 50").sorted("score")[0]);
+    },
+    { iter: 100, size: 1 },
+  );
+
+  for (const aggregate of ["sum", "avg", "min", "max"] as const) {
+    itPerforms(
+      `aggregates using ${aggregate}()`,
+      function (this: RealmContext) {
+        expectNonEmpty(this.realm.objects(ItemSchema.name)[aggregate]("score"));
+      },
+      { iter: 200, size: 1 },
+    );
+  }
+});
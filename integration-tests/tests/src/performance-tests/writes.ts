@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import Realm, { ObjectSchema } from "realm";
+
+import { openRealmBefore } from "../hooks";
+import { itPerforms } from "../utils/benchmark";
+
+const ItemSchema: ObjectSchema = {
+  name: "Item",
+  properties: {
+    name: "string",
+    count: "int",
+    score: "double",
+    createdAt: "date",
+  },
+};
+
+const ItemWithPrimaryKeySchema: ObjectSchema = {
+  name: "ItemWithPrimaryKey",
+  primaryKey: "_id",
+  properties: {
+    _id: "int",
+    name: "string",
+    count: "int",
+  },
+};
+
+const BATCH_SIZE = 1000;
+
+describe.skipIf(environment.performance !== true, "Write performance", () => {
+  describe("creating objects", () => {
+    openRealmBefore({ schema: [ItemSchema, ItemWithPrimaryKeySchema] });
+
+    before(function (this: RealmContext) {
+      // Override toJSON to prevent this being serialized by Mocha Remote
+      Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+      this.realm.beginTransaction();
+    });
+
+    after(function (this: Partial<RealmContext>) {
+      if (this.realm?.isInTransaction) {
+        this.realm.cancelTransaction();
+      }
+    });
+
+    itPerforms(
+      "creates an object",
+      function (this: RealmContext) {
+        this.realm.create(ItemSchema.name, { name: "item", count: 1, score: 1.5, createdAt: new Date() });
+      },
+      { iter: 10000, size: 1 },
+    );
+
+    let nextKey = 0;
+    itPerforms(
+      "creates an object with a primary key",
+      function (this: RealmContext) {
+        this.realm.create(ItemWithPrimaryKeySchema.name, { _id: nextKey++, name: "item", count: 1 });
+      },
+      { iter: 10000, size: 1 },
+    );
+  });
+
+  describe("bulk writes", () => {
+    openRealmBefore({ schema: [ItemSchema, ItemWithPrimaryKeySchema] });
+
+    before(function (this: RealmContext) {
+      Object.defineProperty(this.realm, "toJSON", { value: () => ({}) });
+      this.realm.write(() => {
+        for (let i = 0; i < BATCH_SIZE; i++) {
+          this.realm.create(ItemWithPrimaryKeySchema.name, { _id: i, name: `item-${i}`, count: 0 });
+        }
+      });
+    });
+
+    itPerforms(
+      `commits ${BATCH_SIZE} objects in a single transaction`,
+      function (this: RealmContext) {
+        this.realm.write(() => {
+          for (let i = 0; i < BATCH_SIZE; i++) {
+            this.realm.create(ItemSchema.name, { name: `item-${i}`, count: i, score: i / 2, createdAt: new Date() });
+          }
+        });
+      },
+      { iter: 50, warmup: 5, size: BATCH_SIZE },
+    );
+
+    let count = 0;
+    itPerforms(
+      `upserts ${BATCH_SIZE} objects in a single transaction`,
+      function (this: RealmContext) {
+        count++;
+        this.realm.write(() => {
+          for (let i = 0; i < BATCH_SIZE; i++) {
+            this.realm.create(ItemWithPrimaryKeySchema.name, { _id: i, count }, Realm.UpdateMode.Modified);
+          }
+        });
+      },
+      { iter: 50, warmup: 5, size: BATCH_SIZE },
+    );
+
+    itPerforms(
+      `updates a property of ${BATCH_SIZE} objects in a single transaction`,
+      function (this: RealmContext) {
+        const items = this.realm.objects(ItemWithPrimaryKeySchema.name);
+        this.realm.write(() => {
+          for (const item of items) {
+            item.count = (item.count as number) + 1;
+          }
+        });
+      },
+      { iter: 50, warmup: 5, size: BATCH_SIZE },
+    );
+
+    itPerforms(
+      "commits an empty transaction",
+      function (this: RealmContext) {
+        this.realm.write(() => {});
+      },
+      { iter: 1000, size: 1 },
+    );
+  });
+});
@@ -30,3 +30,6 @@ interface Console {
 }
 
 declare const console: Console;
+
+/** High resolution timestamps, available on all supported platforms */
+declare const performance: { now(): number };
@@ -49,26 +49,40 @@ import "./tests/sync/uuid";
 import "./tests/alias";
 import "./tests/array-buffer";
 import "./tests/bson";
+import "./tests/change-feed";
 import "./tests/class-models";
 import "./tests/counter";
 import "./tests/dictionary";
 import "./tests/dynamic-schema-updates";
 import "./tests/enums";
 import "./tests/exclude-from-icloud-backup";
+import "./tests/export";
+import "./tests/group-by";
+import "./tests/host-objects";
+import "./tests/import";
 import "./tests/iterators";
 import "./tests/linking-objects";
 import "./tests/list";
+import "./tests/listener-coalescing";
+import "./tests/maintenance";
+import "./tests/metrics";
 import "./tests/migrations";
 import "./tests/mixed";
+import "./tests/object-bytes";
 import "./tests/objects";
 import "./tests/observable";
+import "./tests/pagination";
 import "./tests/queries";
 import "./tests/realm-constructor";
 import "./tests/results";
 import "./tests/schema";
+import "./tests/scope";
 import "./tests/serialization";
 import "./tests/set";
 import "./tests/sets";
+import "./tests/shared-queries";
 import "./tests/shared-realms";
+import "./tests/slow-query-log";
+import "./tests/tracing";
 import "./tests/transaction";
 import "./tests/types";
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  primaryKey: "name",
+  properties: {
+    name: "string",
+    age: "int",
+    nickname: { type: "string", optional: true, mapTo: "_nickname" },
+  },
+};
+
+const DogSchema: Realm.ObjectSchema = {
+  name: "Dog",
+  properties: {
+    name: "string",
+  },
+};
+
+describe("Realm#changesSince", () => {
+  openRealmBeforeEach({ schema: [PersonSchema, DogSchema] });
+
+  it("flags the first call as a reset", function (this: RealmContext) {
+    const { token, reset, changes } = this.realm.changesSince();
+    expect(token).to.be.a("string");
+    expect(reset).to.be.true;
+    expect(changes).deep.equals({});
+  });
+
+  it("returns no changes when nothing was written", function (this: RealmContext) {
+    const { token } = this.realm.changesSince();
+    const result = this.realm.changesSince(token);
+    expect(result.reset).to.be.false;
+    expect(result.token).equals(token);
+    expect(result.changes).deep.equals({});
+  });
+
+  it("returns the keys of inserted, modified and deleted objects", function (this: RealmContext) {
+    const [alice, bob, carol] = this.realm.write(() => [
+      this.realm.create<Realm.Object>(PersonSchema.name, { name: "Alice", age: 30 }),
+      this.realm.create<Realm.Object>(PersonSchema.name, { name: "Bob", age: 40 }),
+      this.realm.create<Realm.Object>(PersonSchema.name, { name: "Carol", age: 50 }),
+    ]);
+    const [aliceKey, bobKey, carolKey] = [alice, bob, carol].map((person) => person._objectKey());
+    const { token } = this.realm.changesSince();
+
+    const dave = this.realm.write(() => {
+      alice.age = 31;
+      bob.nickname = "Bobby";
+      this.realm.delete(carol);
+      return this.realm.create<Realm.Object>(PersonSchema.name, { name: "Dave", age: 20 });
+    });
+    const { token: next, reset, changes } = this.realm.changesSince(token);
+    expect(reset).to.be.false;
+    expect(next).not.equals(token);
+    expect(Object.keys(changes)).deep.equals([PersonSchema.name]);
+    expect(changes[PersonSchema.name].insertions).deep.equals([dave._objectKey()]);
+    expect(changes[PersonSchema.name].deletions).deep.equals([carolKey]);
+    expect(changes[PersonSchema.name].modifications).deep.equals(
+      [
+        { objectKey: aliceKey, changedProperties: ["age"] },
+        { objectKey: bobKey, changedProperties: ["nickname"] },
+      ].sort((a, b) => Number(a.objectKey) - Number(b.objectKey)),
+    );
+  });
+
+  it("accumulates the changes of several transactions", function (this: RealmContext) {
+    const { token } = this.realm.changesSince();
+    const dog = this.realm.write(() => this.realm.create<Realm.Object>(DogSchema.name, { name: "Rex" }));
+    this.realm.write(() => {
+      dog.name = "Max";
+    });
+    const temporary = this.realm.write(() => this.realm.create<Realm.Object>(DogSchema.name, { name: "Fido" }));
+    this.realm.write(() => this.realm.delete(temporary));
+
+    const { changes } = this.realm.changesSince(token);
+    expect(changes[DogSchema.name]).deep.equals({
+      insertions: [dog._objectKey()],
+      modifications: [],
+      deletions: [],
+    });
+  });
+
+  it("resumes from the last token returned", function (this: RealmContext) {
+    let { token } = this.realm.changesSince();
+    for (let i = 0; i < 3; i++) {
+      const dog = this.realm.write(() => this.realm.create<Realm.Object>(DogSchema.name, { name: `Dog ${i}` }));
+      const result = this.realm.changesSince(token);
+      expect(result.reset).to.be.false;
+      expect(result.changes[DogSchema.name].insertions).deep.equals([dog._objectKey()]);
+      token = result.token;
+    }
+  });
+
+  it("flags a reset when the version is no longer available", function (this: RealmContext) {
+    const { token } = this.realm.changesSince();
+    const { path } = this.realm;
+    this.realm.close();
+    this.realm = new Realm({ path, schema: [PersonSchema, DogSchema] });
+    this.realm.write(() => this.realm.create(DogSchema.name, { name: "Rex" }));
+    const result = this.realm.changesSince(token);
+    expect(result.reset).to.be.true;
+    expect(result.changes).deep.equals({});
+  });
+
+  it("throws on malformed tokens", function (this: RealmContext) {
+    expect(() => this.realm.changesSince("not a token")).throws("Expected a change token");
+  });
+});
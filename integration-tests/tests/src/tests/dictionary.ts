@@ -440,6 +440,38 @@ describe("Dictionary", () => {
     });
   });
 
+  describe("entriesOf", function () {
+    openRealmBefore({
+      schema: [
+        {
+          name: "Item",
+          properties: { dict: "mixed{}" },
+        },
+      ],
+    });
+
+    it("reads all or some of the entries", function (this: RealmContext) {
+      const { dict } = this.realm.write(() => {
+        return this.realm.create<Item>("Item", {
+          dict: { "user.name": "Alice", "user.age": 30, "app.theme": "dark", nested: { list: [1, 2] } },
+        });
+      });
+      const entries = Realm.Dictionary.entriesOf(dict);
+      expect(entries.map(([key]) => key).sort()).deep.equals(["app.theme", "nested", "user.age", "user.name"]);
+      expect(entries).deep.equals([...dict.entries()]);
+      expect(Realm.Dictionary.entriesOf(dict, { prefix: "user." }).sort()).deep.equals([
+        ["user.age", 30],
+        ["user.name", "Alice"],
+      ]);
+      expect(Realm.Dictionary.entriesOf(dict, { keys: ["app.theme", "missing"] })).deep.equals([
+        ["app.theme", "dark"],
+      ]);
+      const [[, nested]] = Realm.Dictionary.entriesOf(dict, { keys: ["nested"] });
+      expect(nested).instanceOf(Realm.Dictionary);
+      expect((nested as Realm.Dictionary).toJSON()).deep.equals({ list: [1, 2] });
+    });
+  });
+
   type ValueGenerator = (realm: Realm) => DictValues;
 
   type TypedDictionarySuite = {
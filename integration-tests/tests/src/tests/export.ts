@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+import { PersonSchema } from "../schemas/person-and-dogs";
+
+const ExportedSchema: Realm.ObjectSchema = {
+  name: "Exported",
+  properties: {
+    name: "string",
+    score: "double?",
+    active: "bool",
+    created: "date",
+    tags: "string[]",
+  },
+};
+
+describe("Results#exportTo", () => {
+  openRealmBeforeEach({ schema: [ExportedSchema, PersonSchema] });
+
+  function exportPath(realm: Realm, extension: string) {
+    return path.resolve(path.dirname(realm.path), `exported.${extension}`);
+  }
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      this.realm.create(ExportedSchema.name, {
+        name: "Alice",
+        score: 1.5,
+        active: true,
+        created: new Date("2024-01-31T12:34:56.789Z"),
+      });
+      this.realm.create(ExportedSchema.name, {
+        name: 'Bob "the, builder"',
+        score: null,
+        active: false,
+        created: new Date("1969-12-31T23:59:59.500Z"),
+      });
+    });
+  });
+
+  it("writes NDJSON", async function (this: RealmContext) {
+    const file = exportPath(this.realm, "ndjson");
+    const rows = await this.realm.objects(ExportedSchema.name).exportTo(file);
+    expect(rows).equals(2);
+    if (!fs.readFile) {
+      return;
+    }
+    const lines = fs.readFile(file).trimEnd().split("\n");
+    expect(lines.map((line) => JSON.parse(line))).deep.equals([
+      { name: "Alice", score: 1.5, active: true, created: "2024-01-31T12:34:56.789Z" },
+      { name: 'Bob "the, builder"', score: null, active: false, created: "1969-12-31T23:59:59.500Z" },
+    ]);
+  });
+
+  it("writes CSV with the requested columns", async function (this: RealmContext) {
+    const file = exportPath(this.realm, "csv");
+    const rows = await this.realm
+      .objects(ExportedSchema.name)
+      .sorted("name", true)
+      .exportTo(file, { format: "csv", columns: ["score", "name"] });
+    expect(rows).equals(2);
+    if (!fs.readFile) {
+      return;
+    }
+    expect(fs.readFile(file)).equals('score,name\r\n,"Bob ""the, builder"""\r\n1.5,Alice\r\n');
+  });
+
+  it("writes an Arrow IPC stream", async function (this: RealmContext) {
+    const file = exportPath(this.realm, "arrows");
+    const rows = await this.realm.objects(ExportedSchema.name).exportTo(file, { format: "arrow" });
+    expect(rows).equals(2);
+    expect(fs.exists(file)).equals(true);
+  });
+
+  it("reports progress per batch", async function (this: RealmContext) {
+    const progress: number[] = [];
+    await this.realm.objects(ExportedSchema.name).exportTo(exportPath(this.realm, "ndjson"), {
+      batchSize: 1,
+      onProgress: (rows) => progress.push(rows),
+    });
+    expect(progress).deep.equals([1, 2]);
+  });
+
+  it("exports the version at the time of the call", async function (this: RealmContext) {
+    const promise = this.realm.objects(ExportedSchema.name).exportTo(exportPath(this.realm, "ndjson"));
+    this.realm.write(() => {
+      this.realm.delete(this.realm.objects(ExportedSchema.name));
+    });
+    expect(await promise).equals(2);
+  });
+
+  it("throws on properties which can't be exported", function (this: RealmContext) {
+    const results = this.realm.objects(ExportedSchema.name);
+    expect(() => results.exportTo(exportPath(this.realm, "csv"), { columns: ["tags"] })).throws(
+      "Property 'tags' can't be exported",
+    );
+    expect(() => results.exportTo(exportPath(this.realm, "csv"), { columns: ["unknown"] })).throws(
+      "Property 'unknown' does not exist on 'Exported' objects",
+    );
+    expect(() => results.exportTo(exportPath(this.realm, "csv"), { format: "xml" as "csv" })).throws(
+      "Unexpected export format: 'xml'",
+    );
+  });
+
+  it("rejects when the file can't be written", async function (this: RealmContext) {
+    const file = path.resolve(path.dirname(this.realm.path), "missing-directory", "exported.ndjson");
+    await expect(this.realm.objects(PersonSchema.name).exportTo(file)).to.be.rejectedWith("Failed to open");
+  });
+});
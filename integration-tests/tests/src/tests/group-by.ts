@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+const CustomerSchema: Realm.ObjectSchema = {
+  name: "Customer",
+  properties: {
+    name: "string",
+  },
+};
+
+const OrderSchema: Realm.ObjectSchema = {
+  name: "Order",
+  properties: {
+    customer: "Customer?",
+    day: "string",
+    amount: "int",
+    weight: { type: "double", optional: true, mapTo: "_weight" },
+    placed: "date",
+  },
+};
+
+describe("Results#groupBy", () => {
+  openRealmBeforeEach({ schema: [CustomerSchema, OrderSchema] });
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      const alice = this.realm.create(CustomerSchema.name, { name: "Alice" });
+      const bob = this.realm.create(CustomerSchema.name, { name: "Bob" });
+      const orders = [
+        { customer: alice, day: "mon", amount: 10, weight: 1.5, placed: new Date(1000) },
+        { customer: bob, day: "mon", amount: 5, weight: null, placed: new Date(2000) },
+        { customer: alice, day: "tue", amount: 7, weight: 2.5, placed: new Date(3000) },
+        { customer: alice, day: "mon", amount: 3, weight: 0.5, placed: new Date(4000) },
+        { customer: null, day: "tue", amount: 1, weight: null, placed: new Date(5000) },
+      ];
+      for (const order of orders) {
+        this.realm.create(OrderSchema.name, order);
+      }
+    });
+  });
+
+  it("aggregates per group", function (this: RealmContext) {
+    const { length, keys, values } = this.realm
+      .objects(OrderSchema.name)
+      .groupBy("customer.name")
+      .aggregate({
+        total: ["sum", "amount"],
+        orders: ["count"],
+        weighed: ["count", "weight"],
+        heaviest: ["max", "weight"],
+        average: ["avg", "amount"],
+        first: ["min", "placed"],
+      });
+    expect(length).equals(3);
+    expect(keys["customer.name"]).deep.equals(["Alice", "Bob", null]);
+    expect(values.total).deep.equals([20, 5, 1]);
+    expect(values.orders).deep.equals([3, 1, 1]);
+    expect(values.weighed).deep.equals([3, 0, 0]);
+    expect(values.heaviest).deep.equals([2.5, null, null]);
+    expect(values.average).deep.equals([20 / 3, 5, 1]);
+    expect(values.first).deep.equals([new Date(1000), new Date(2000), new Date(5000)]);
+  });
+
+  it("groups by multiple key paths", function (this: RealmContext) {
+    const { length, keys, values } = this.realm
+      .objects(OrderSchema.name)
+      .sorted("day")
+      .groupBy(["customer.name", "day"])
+      .aggregate({ total: ["sum", "amount"] });
+    expect(length).equals(4);
+    expect(keys["customer.name"]).deep.equals(["Alice", "Bob", "Alice", null]);
+    expect(keys.day).deep.equals(["mon", "mon", "tue", "tue"]);
+    expect(values.total).deep.equals([13, 5, 7, 1]);
+  });
+
+  it("aggregates filtered collections", function (this: RealmContext) {
+    const { keys, values } = this.realm
+      .objects(OrderSchema.name)
+      .filtered("amount > 4")
+      .groupBy("day")
+      .aggregate({ orders: ["count"] });
+    expect(keys.day).deep.equals(["mon", "tue"]);
+    expect(values.orders).deep.equals([2, 1]);
+  });
+
+  it("aggregates off the JS thread", async function (this: RealmContext) {
+    const orders = this.realm.objects(OrderSchema.name);
+    const pending = orders.groupBy("day").aggregateAsync({ total: ["sum", "amount"] });
+    // Writes made while aggregating aren't included
+    this.realm.write(() => {
+      this.realm.create(OrderSchema.name, { day: "wed", amount: 100, placed: new Date() });
+    });
+    const { length, keys, values } = await pending;
+    expect(length).equals(2);
+    expect(keys.day).deep.equals(["mon", "tue"]);
+    expect(values.total).deep.equals([18, 8]);
+  });
+
+  it("returns no groups for an empty collection", function (this: RealmContext) {
+    const { length, keys } = this.realm
+      .objects(OrderSchema.name)
+      .filtered("amount > 1000")
+      .groupBy("day")
+      .aggregate({ orders: ["count"] });
+    expect(length).equals(0);
+    expect(keys.day).deep.equals([]);
+  });
+
+  it("throws on invalid aggregates", function (this: RealmContext) {
+    const grouped = this.realm.objects(OrderSchema.name).groupBy("day");
+    expect(() => grouped.aggregate({ total: ["sum", "day"] })).throws(
+      "Can't compute the 'sum' of 'day', only of int, float and double properties",
+    );
+    expect(() => grouped.aggregate({ total: ["sum", "price"] })).throws(
+      "Property 'price' does not exist on 'Order' objects",
+    );
+    expect(() => this.realm.objects(OrderSchema.name).groupBy("customer").aggregate({ n: ["count"] })).throws(
+      "Can't group by the link 'customer', use a property of the linked object",
+    );
+  });
+});
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm, { ObjectSchema } from "realm";
+
+import { openRealmBeforeEach } from "../hooks";
+
+const ItemSchema: ObjectSchema = {
+  name: "Item",
+  primaryKey: "_id",
+  properties: {
+    _id: "int",
+    name: "string",
+    price: "double?",
+    available: "bool",
+    tags: "string[]",
+  },
+};
+
+type Item = { _id: number; name: string; price?: number | null; available: boolean; tags: Realm.List<string> };
+
+// The fast path is only implemented by the JSI binding, but objects must behave the same with and without it.
+describe("Realm.flags.OBJECT_HOST_FAST_PATH", () => {
+  let previous = false;
+
+  before(() => {
+    previous = Realm.flags.OBJECT_HOST_FAST_PATH;
+    Realm.flags.OBJECT_HOST_FAST_PATH = true;
+  });
+
+  after(() => {
+    Realm.flags.OBJECT_HOST_FAST_PATH = previous;
+  });
+
+  openRealmBeforeEach({ schema: [ItemSchema] });
+
+  beforeEach(function (this: RealmObjectContext<Item>) {
+    this.object = this.realm.write(() =>
+      this.realm.create<Item>(ItemSchema.name, { _id: 1, name: "Widget", price: 9.99, available: true, tags: ["a"] }),
+    );
+  });
+
+  it("keeps the prototype and methods", function (this: RealmObjectContext<Item>) {
+    expect(this.object).instanceOf(Realm.Object);
+    expect(this.object.isValid()).equals(true);
+    expect(this.object.objectSchema().name).equals(ItemSchema.name);
+  });
+
+  it("reads and writes properties", function (this: RealmObjectContext<Item>) {
+    expect(this.object.name).equals("Widget");
+    expect(this.object.price).equals(9.99);
+    expect(this.object.available).equals(true);
+    expect([...this.object.tags]).deep.equals(["a"]);
+
+    this.realm.write(() => {
+      this.object.name = "Gadget";
+      this.object.price = null;
+      this.object.available = false;
+    });
+    expect(this.object.name).equals("Gadget");
+    expect(this.object.price).equals(null);
+    expect(this.object.available).equals(false);
+  });
+
+  it("spreads all properties", function (this: RealmObjectContext<Item>) {
+    expect(Object.keys(this.object)).deep.equals(["_id", "name", "price", "available", "tags"]);
+  });
+
+  it("throws the same errors", function (this: RealmObjectContext<Item>) {
+    expect(() => {
+      this.object.name = "Outside";
+    }).throws("outside of a write transaction");
+    this.realm.write(() => {
+      expect(() => {
+        // @ts-expect-error Testing an invalid value
+        this.object.name = 42;
+      }).throws(Realm.TypeAssertionError);
+      expect(() => {
+        this.object._id = 2;
+      }).throws();
+    });
+    this.realm.write(() => {
+      this.realm.delete(this.object);
+    });
+    expect(() => this.object.name).throws("invalidated");
+  });
+
+  it("releases objects read within a scope", function (this: RealmObjectContext<Item>) {
+    const item = this.realm.scope(() => this.realm.objectForPrimaryKey<Item>(ItemSchema.name, 1));
+    expect(item).not.equals(null);
+    expect(() => item?.name).throws("has been released and can no longer be used");
+    expect(() => item?.price).throws("has been released and can no longer be used");
+    expect(() => {
+      this.realm.write(() => {
+        if (item) {
+          item.name = "Released";
+        }
+      });
+    }).throws("has been released and can no longer be used");
+    expect(this.object.name).equals("Widget");
+  });
+});
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+import { IPerson, PersonSchema } from "../schemas/person-and-dogs";
+
+const RoundTripSchema: Realm.ObjectSchema = {
+  name: "RoundTrip",
+  properties: {
+    index: "int",
+    label: "string",
+    note: "string?",
+    value: "mixed",
+  },
+};
+
+type RoundTrip = { index: number; label: string; note: string | null; value: Realm.Types.Mixed };
+
+describe("Realm#importFrom", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  function filePath(realm: Realm, extension: string) {
+    return path.resolve(path.dirname(realm.path), `imported.${extension}`);
+  }
+
+  function persons(realm: Realm) {
+    return realm
+      .objects<IPerson>(PersonSchema.name)
+      .sorted("name")
+      .map(({ name, age }) => ({ name, age }));
+  }
+
+  async function exportAndClear(realm: Realm, extension: "ndjson" | "csv") {
+    realm.write(() => {
+      for (let i = 0; i < 25; i++) {
+        realm.create(PersonSchema.name, { name: `Person ${i}`, age: i });
+      }
+    });
+    const expected = persons(realm);
+    const file = filePath(realm, extension);
+    await realm.objects(PersonSchema.name).exportTo(file, { format: extension });
+    realm.write(() => {
+      realm.deleteAll();
+    });
+    return { file, expected };
+  }
+
+  for (const format of ["ndjson", "csv"] as const) {
+    it(`imports what was exported as ${format}`, async function (this: RealmContext) {
+      const { file, expected } = await exportAndClear(this.realm, format);
+      const progress: number[] = [];
+      const result = await this.realm.importFrom(file, PersonSchema.name, {
+        format,
+        batchSize: 10,
+        onProgress: (processed) => progress.push(processed),
+      });
+      expect(result).deep.equals({ imported: 25, errors: 0, errorMessages: [] });
+      expect(progress).deep.equals([10, 20, 25]);
+      this.realm.refresh();
+      expect(persons(this.realm)).deep.equals(expected);
+    });
+  }
+
+  it("counts existing primary keys as errors when inserting", async function (this: RealmContext) {
+    const { file } = await exportAndClear(this.realm, "ndjson");
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Person 3", age: 100 });
+    });
+    const { imported, errors, errorMessages } = await this.realm.importFrom(file, PersonSchema.name);
+    expect(imported).equals(24);
+    expect(errors).equals(1);
+    expect(errorMessages).length(1);
+    expect(errorMessages[0]).matches(/^Line \d+: An object with primary key "?Person 3"? already exists$/);
+    this.realm.refresh();
+    expect(this.realm.objectForPrimaryKey<IPerson>(PersonSchema.name, "Person 3")?.age).equals(100);
+  });
+
+  it("updates existing objects when upserting", async function (this: RealmContext) {
+    const { file } = await exportAndClear(this.realm, "csv");
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Person 3", age: 100 });
+    });
+    const result = await this.realm.importFrom(file, PersonSchema.name, { format: "csv", mode: "upsert" });
+    expect(result.imported).equals(25);
+    this.realm.refresh();
+    expect(this.realm.objectForPrimaryKey<IPerson>(PersonSchema.name, "Person 3")?.age).equals(3);
+  });
+
+  it("counts invalid records as errors", async function (this: RealmContext) {
+    if (!fs.writeFile) {
+      this.skip();
+    }
+    const file = filePath(this.realm, "ndjson");
+    fs.writeFile(
+      file,
+      ['{"name":"Alice","age":30}', "not json", '{"age":40}', '{"name":"Bob","age":"old"}', ""].join("\n"),
+    );
+    const { imported, errors, errorMessages } = await this.realm.importFrom(file, PersonSchema.name);
+    expect(imported).equals(1);
+    expect(errors).equals(3);
+    expect(errorMessages).include("Line 3: Missing primary key");
+    expect(errorMessages).include("Line 4: Invalid integer 'old'");
+  });
+
+  it("throws within a write transaction", function (this: RealmContext) {
+    this.realm.write(() => {
+      expect(() => this.realm.importFrom(filePath(this.realm, "ndjson"), PersonSchema.name)).throws(
+        "Cannot import within a transaction.",
+      );
+    });
+  });
+
+  it("rejects when the file can't be read", async function (this: RealmContext) {
+    await expect(this.realm.importFrom(filePath(this.realm, "missing"), PersonSchema.name)).to.be.rejectedWith(
+      "Failed to open",
+    );
+  });
+});
+
+describe("Realm#importFrom of exported files", () => {
+  openRealmBeforeEach({ schema: [RoundTripSchema] });
+
+  const values: Realm.Types.Mixed[] = [
+    "",
+    "text",
+    "42",
+    42,
+    1.5,
+    true,
+    null,
+    new Date("2024-01-31T12:34:56.789Z"),
+    new Realm.BSON.ObjectId("0123456789abcdef01234567"),
+    new Realm.BSON.UUID("01234567-89ab-cdef-0123-456789abcdef"),
+    Realm.BSON.Decimal128.fromString("1.25"),
+  ];
+
+  // Tells apart the types which are compared as equal, such as strings and numbers
+  function describeValue(value: unknown) {
+    if (value instanceof Date) {
+      return `Date(${value.toISOString()})`;
+    } else if (
+      value instanceof Realm.BSON.ObjectId ||
+      value instanceof Realm.BSON.UUID ||
+      value instanceof Realm.BSON.Decimal128
+    ) {
+      return `${value.constructor.name}(${value.toString()})`;
+    } else {
+      return `${typeof value}(${String(value)})`;
+    }
+  }
+
+  function records(realm: Realm) {
+    return realm
+      .objects<RoundTrip>(RoundTripSchema.name)
+      .sorted("index")
+      .map(({ index, label, note, value }) => ({ index, label, note, value: describeValue(value) }));
+  }
+
+  for (const format of ["ndjson", "csv"] as const) {
+    it(`keeps empty strings and the types of mixed values in ${format}`, async function (this: RealmContext) {
+      this.realm.write(() => {
+        values.forEach((value, index) => {
+          this.realm.create(RoundTripSchema.name, { index, label: index % 2 ? "" : "label", note: "", value });
+        });
+        this.realm.create(RoundTripSchema.name, { index: values.length, label: "", note: null, value: null });
+      });
+      const expected = records(this.realm);
+      const file = path.resolve(path.dirname(this.realm.path), `round-trip.${format}`);
+      await this.realm.objects(RoundTripSchema.name).exportTo(file, { format });
+      this.realm.write(() => {
+        this.realm.deleteAll();
+      });
+      const result = await this.realm.importFrom(file, RoundTripSchema.name, { format });
+      expect(result).deep.equals({ imported: values.length + 1, errors: 0, errorMessages: [] });
+      this.realm.refresh();
+      expect(records(this.realm)).deep.equals(expected);
+    });
+  }
+});
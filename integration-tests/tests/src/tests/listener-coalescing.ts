@@ -0,0 +1,141 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+import { createPromiseHandle } from "../utils/promise-handle";
+import { sleep } from "../utils/sleep";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  properties: {
+    name: "string",
+    age: "int",
+    scores: "int{}",
+  },
+};
+
+type Person = { name: string; age: number; scores: Realm.Dictionary<number> };
+
+function listen(collection: Realm.Results<Person>, options: Realm.CollectionListenerOptions) {
+  const changes: Realm.CollectionChangeSet[] = [];
+  let handle = createPromiseHandle();
+  const callback = (_: unknown, change: Realm.CollectionChangeSet) => {
+    changes.push(change);
+    handle.resolve();
+  };
+  collection.addListener(callback, options);
+  return {
+    changes,
+    callback,
+    async next() {
+      await handle;
+      handle = createPromiseHandle();
+    },
+  };
+}
+
+describe("Listener coalescing", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  async function writeEach(this: RealmContext, names: string[]) {
+    for (const name of names) {
+      this.realm.write(() => {
+        this.realm.create(PersonSchema.name, { name, age: 30 });
+      });
+      await sleep(10);
+    }
+  }
+
+  it("delivers the initial notification right away", async function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const listener = listen(persons, { minIntervalMs: 60_000 });
+    await listener.next();
+    expect(listener.changes).deep.equals([
+      { deletions: [], insertions: [], oldModifications: [], newModifications: [] },
+    ]);
+    persons.removeAllListeners();
+  });
+
+  it("merges the changes of several commits", async function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const listener = listen(persons, { minIntervalMs: 500 });
+    await listener.next();
+    await writeEach.call(this, ["Alice", "Bob", "Charlie"]);
+    this.realm.write(() => {
+      persons[0].age = 31;
+      this.realm.delete(persons[1]);
+    });
+    await listener.next();
+    expect(listener.changes).has.length(2);
+    expect(listener.changes[1]).deep.equals({
+      deletions: [],
+      insertions: [0, 1],
+      oldModifications: [],
+      newModifications: [],
+    });
+    persons.removeAllListeners();
+  });
+
+  it("waits for changes to stop until the maximum delay", async function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const listener = listen(persons, { minIntervalMs: 50, maxDelayMs: 150 });
+    await listener.next();
+    const start = Date.now();
+    const writing = writeEach.call(this, new Array(30).fill("Alice"));
+    await listener.next();
+    expect(Date.now() - start).lessThan(300);
+    expect(listener.changes[1].insertions.length).greaterThan(1).lessThan(30);
+    await writing;
+    persons.removeAllListeners();
+  });
+
+  it("stops delivering once removed", async function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const listener = listen(persons, { minIntervalMs: 50 });
+    await listener.next();
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice", age: 30 });
+    });
+    persons.removeListener(listener.callback);
+    await sleep(100);
+    expect(listener.changes).has.length(1);
+  });
+
+  it("throws on invalid intervals", function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const callback = () => {};
+    expect(() => persons.addListener(callback, { minIntervalMs: 0 })).throws("Expected 'minIntervalMs' to be positive");
+    expect(() => persons.addListener(callback, { maxDelayMs: 10 })).throws("Expected 'minIntervalMs'");
+    expect(() => persons.addListener(callback, { minIntervalMs: 10, maxDelayMs: 5 })).throws(
+      "Expected 'maxDelayMs' to be at least 'minIntervalMs'",
+    );
+  });
+
+  it("throws for dictionaries", function (this: RealmContext) {
+    const person = this.realm.write(() => this.realm.create<Person>(PersonSchema.name, { name: "Alice", age: 30 }));
+    const callback = () => {};
+    expect(() => person.scores.addListener(callback, { minIntervalMs: 10 })).throws(
+      "Expected no 'minIntervalMs' or 'maxDelayMs' for a listener of a dictionary",
+    );
+    expect(() => person.scores.addListener(callback, { minIntervalMs: 10, maxDelayMs: 20 })).throws(
+      "Expected no 'minIntervalMs' or 'maxDelayMs' for a listener of a dictionary",
+    );
+  });
+});
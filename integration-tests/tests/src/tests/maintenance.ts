@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+import { PersonSchema } from "../schemas/person-and-dogs";
+import { createPromiseHandle } from "../utils/promise-handle";
+
+describe("Realm#fileStats", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  it("reports the space used by each object type", function (this: RealmContext) {
+    this.realm.write(() => {
+      for (let i = 0; i < 100; i++) {
+        this.realm.create(PersonSchema.name, { name: `Person ${i}`, age: i });
+      }
+    });
+    const { totalBytes, usedBytes, freeBytes, version, pinnedVersions, largestTables } = this.realm.fileStats();
+    expect(totalBytes).greaterThan(0);
+    expect(usedBytes).greaterThan(0);
+    expect(usedBytes + freeBytes).equals(totalBytes);
+    expect(version).greaterThan(0);
+    expect(pinnedVersions).greaterThan(0);
+    const [person] = largestTables;
+    expect(person.objectType).equals(PersonSchema.name);
+    expect(person.objectCount).equals(100);
+    expect(person.bytes).greaterThan(0);
+  });
+
+  it("limits the number of tables", function (this: RealmContext) {
+    expect(this.realm.fileStats({ maxTables: 0 }).largestTables).deep.equals([]);
+  });
+});
+
+describe("Realm#startMaintenance", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  afterEach(function (this: RealmContext) {
+    this.realm.stopMaintenance();
+  });
+
+  it("compacts once idle", async function (this: RealmContext) {
+    const handle = createPromiseHandle<Realm.MaintenanceEvent>();
+    this.realm.startMaintenance({
+      checkIntervalMs: 10,
+      shouldCompact: () => true,
+      onEvent: (event) => handle.resolve(event),
+    });
+    const event = await handle;
+    expect(event.type).equals("compacted");
+    if (event.type === "compacted") {
+      expect(event.after.totalBytes).lessThanOrEqual(event.before.totalBytes);
+    }
+  });
+
+  it("doesn't compact below the thresholds", async function (this: RealmContext) {
+    const events: Realm.MaintenanceEvent[] = [];
+    this.realm.startMaintenance({ checkIntervalMs: 10, onEvent: (event) => events.push(event) });
+    await new Promise((resolve) => setTimeout(resolve, 100));
+    expect(events).deep.equals([]);
+  });
+
+  it("reports pinned versions", async function (this: RealmContext) {
+    const handle = createPromiseHandle<Realm.MaintenanceEvent>();
+    this.realm.startMaintenance({
+      checkIntervalMs: 10,
+      maxPinnedVersions: 0,
+      onEvent: (event) => handle.resolve(event),
+    });
+    const event = await handle;
+    expect(event.type).equals("pinnedVersions");
+  });
+
+  it("validates the policy", function (this: RealmContext) {
+    expect(() => this.realm.startMaintenance({ minFreeRatio: 2 })).throws(
+      "'minFreeRatio' on maintenance policy must be between 0 and 1.",
+    );
+  });
+});
+
+describe("Asynchronous file management", () => {
+  describe("Realm#compactAsync", () => {
+    openRealmBeforeEach({ schema: [PersonSchema] });
+
+    it("compacts without blocking", async function (this: RealmContext) {
+      this.realm.write(() => {
+        for (let i = 0; i < 100; i++) {
+          this.realm.create(PersonSchema.name, { name: `Person ${i}`, age: i });
+        }
+      });
+      this.realm.write(() => this.realm.deleteAll());
+      const { totalBytes: before } = this.realm.fileStats();
+      expect(await this.realm.compactAsync()).equals(true);
+      expect(this.realm.fileStats().totalBytes).lessThanOrEqual(before);
+      expect(this.realm.objects(PersonSchema.name).length).equals(0);
+    });
+
+    it("throws within a transaction", function (this: RealmContext) {
+      this.realm.write(() => {
+        expect(() => this.realm.compactAsync()).throws("Cannot compact a Realm within a transaction.");
+      });
+    });
+
+    it("throws on access until compacted", async function (this: RealmContext) {
+      const compacted = this.realm.compactAsync();
+      expect(() => this.realm.objects(PersonSchema.name)).throws("Cannot access a Realm while it is being compacted.");
+      expect(() => this.realm.write(() => {})).throws("Cannot access a Realm while it is being compacted.");
+      expect(() => this.realm.compactAsync()).throws("Cannot access a Realm while it is being compacted.");
+      await compacted;
+      expect(this.realm.objects(PersonSchema.name).length).equals(0);
+    });
+  });
+
+  describe("Realm#writeCopyToAsync", () => {
+    openRealmBeforeEach({ schema: [PersonSchema] });
+
+    it("writes a copy of the current version", async function (this: RealmContext) {
+      this.realm.write(() => {
+        this.realm.create(PersonSchema.name, { name: "Alice", age: 42 });
+      });
+      const copyPath = path.resolve(path.dirname(this.realm.path), "async-copy.realm");
+      Realm.deleteFile({ path: copyPath });
+      const written = this.realm.writeCopyToAsync({ path: copyPath });
+      // Changes made while the copy is written aren't included
+      this.realm.write(() => {
+        this.realm.create(PersonSchema.name, { name: "Bob", age: 43 });
+      });
+      await written;
+      const copy = new Realm({ path: copyPath, schema: [PersonSchema] });
+      try {
+        expect(copy.objects(PersonSchema.name).map((person) => person.name)).deep.equals(["Alice"]);
+      } finally {
+        copy.close();
+        Realm.deleteFile({ path: copyPath });
+      }
+    });
+  });
+
+  describe("Realm.deleteFileAsync", () => {
+    it("deletes the Realm and its auxiliary files", async () => {
+      const config = { path: "delete-async.realm", schema: [PersonSchema] };
+      const realm = new Realm(config);
+      const realmPath = realm.path;
+      realm.close();
+      expect(Realm.exists(config)).equals(true);
+      await Realm.deleteFileAsync(config);
+      expect(Realm.exists(config)).equals(false);
+      expect(fs.exists(realmPath + ".lock")).equals(false);
+      expect(fs.exists(realmPath + ".management")).equals(false);
+    });
+
+    it("ignores missing files", async () => {
+      await Realm.deleteFileAsync({ path: "never-opened.realm" });
+    });
+  });
+});
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+import { expect } from "chai";
+import { openRealmBeforeEach } from "../hooks";
+
+import { PersonSchema } from "../schemas/person-and-dogs";
+import { createPromiseHandle } from "../utils/promise-handle";
+
+describe("Realm#metrics", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  it("starts out empty", function (this: RealmContext) {
+    const { writeLockWait, commit, commitBytes, notificationCallbacks } = this.realm.metrics();
+    expect(writeLockWait.count).equals(0);
+    expect(commit.count).equals(0);
+    expect(commitBytes.total).equals(0);
+    expect(notificationCallbacks).deep.equals({});
+  });
+
+  it("records write transactions", function (this: RealmContext) {
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice", age: 42 });
+    });
+    this.realm.beginTransaction();
+    this.realm.create(PersonSchema.name, { name: "Bob", age: 24 });
+    this.realm.commitTransaction();
+
+    const { writeLockWait, commit, commitBytes, versions } = this.realm.metrics();
+    expect(writeLockWait.count).equals(2);
+    expect(commit.count).equals(2);
+    expect(commit.buckets.reduce((sum, count) => sum + count, 0)).equals(2);
+    expect(commit.maxMs).lessThanOrEqual(commit.totalMs);
+    expect(commitBytes.last).greaterThan(0);
+    expect(commitBytes.total).greaterThanOrEqual(commitBytes.max);
+    expect(versions.current).greaterThan(0);
+    expect(versions.pinned).greaterThan(0);
+  });
+
+  it("doesn't record cancelled transactions as commits", function (this: RealmContext) {
+    this.realm.beginTransaction();
+    this.realm.cancelTransaction();
+    const { writeLockWait, commit } = this.realm.metrics();
+    expect(writeLockWait.count).equals(1);
+    expect(commit.count).equals(0);
+  });
+
+  it("doesn't record commits outside of write transactions", function (this: RealmContext) {
+    expect(() => this.realm.commitTransaction()).throws("Can't commit a non-existing write transaction");
+    const { commit, commitBytes } = this.realm.metrics();
+    expect(commit.count).equals(0);
+    expect(commitBytes.total).equals(0);
+  });
+
+  it("records notification callbacks per object type", async function (this: RealmContext) {
+    const handle = createPromiseHandle();
+    const persons = this.realm.objects(PersonSchema.name);
+    persons.addListener(() => handle.resolve());
+    await handle;
+    persons.removeAllListeners();
+
+    const { notificationCallbacks } = this.realm.metrics();
+    expect(notificationCallbacks).has.keys(PersonSchema.name);
+    expect(notificationCallbacks[PersonSchema.name].count).equals(1);
+  });
+
+  it("can be reset", function (this: RealmContext) {
+    this.realm.write(() => {});
+    this.realm.resetMetrics();
+    const { writeLockWait, commit, fileSize } = this.realm.metrics();
+    expect(writeLockWait.count).equals(0);
+    expect(commit.count).equals(0);
+    // File and version stats aren't counters and are unaffected
+    expect(fileSize).greaterThan(0);
+  });
+});
@@ -2902,6 +2902,47 @@ describe("Mixed", () => {
     });
   });
 
+  describe("Plain values", () => {
+    openRealmBeforeEach({ schema: [MixedSchema] });
+
+    const payload = {
+      id: 1,
+      name: "event",
+      at: new Date(1700000000000),
+      tags: ["a", "b", ["c", { d: null }]],
+      nested: { deeper: { deepest: [1, 2.5, true, { e: "f" }] } },
+    };
+
+    it("reads nested collections as plain values", function (this: RealmContext) {
+      const { mixed } = this.realm.write(() => this.realm.create<IMixedSchema>(MixedSchema.name, { mixed: payload }));
+      expectRealmDictionary(mixed);
+      const created = this.realm.objects<IMixedSchema>(MixedSchema.name)[0];
+      expect(created.getPlainValue("mixed")).deep.equals(payload);
+    });
+
+    it("reads values which aren't collections", function (this: RealmContext) {
+      const created = this.realm.write(() => this.realm.create<IMixedSchema>(MixedSchema.name, { mixed: "value" }));
+      expect(created.getPlainValue("mixed")).equals("value");
+      this.realm.write(() => {
+        created.mixed = null;
+      });
+      expect(created.getPlainValue("mixed")).equals(null);
+    });
+
+    it("assigns a collection of the same property", function (this: RealmContext) {
+      const created = this.realm.write(() => this.realm.create<IMixedSchema>(MixedSchema.name, { mixed: payload }));
+      this.realm.write(() => {
+        created.mixed = created.mixed;
+      });
+      expect(created.getPlainValue("mixed")).deep.equals(payload);
+    });
+
+    it("throws on other properties", function (this: RealmContext) {
+      const created = this.realm.write(() => this.realm.create<IMixedSchema>(MixedSchema.name, { mixed: 1 }));
+      expect(() => created.getPlainValue("other")).throws();
+    });
+  });
+
   describe("Typed arrays in Mixed", () => {
     openRealmBeforeEach({ schema: [MixedSchema] });
 
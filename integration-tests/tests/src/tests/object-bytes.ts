@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+const AttachmentSchema: Realm.ObjectSchema = {
+  name: "Attachment",
+  properties: {
+    name: "string?",
+    content: "data?",
+    size: "int",
+  },
+};
+
+const BlobSchema: Realm.ObjectSchema = {
+  name: "Blob",
+  properties: {
+    content: "data",
+    byteLength: "int",
+  },
+};
+
+type Attachment = { name: string | null; content: ArrayBuffer | null; size: number };
+
+function bytes(buffer: ArrayBuffer) {
+  return [...new Uint8Array(buffer)];
+}
+
+describe("Ranged reads and chunked writes", () => {
+  openRealmBeforeEach({ schema: [AttachmentSchema, BlobSchema] });
+
+  let attachment: Attachment & Realm.Object;
+
+  beforeEach(function (this: RealmContext) {
+    attachment = this.realm.write(() =>
+      this.realm.create<Attachment & Realm.Object>(AttachmentSchema.name, {
+        name: "héllo",
+        content: new Uint8Array([0, 1, 2, 3, 4, 5, 6, 7]).buffer,
+        size: 8,
+      }),
+    );
+  });
+
+  it("reads a range of a data property", function (this: RealmContext) {
+    expect(Realm.Object.byteLength(attachment, "content")).equals(8);
+    expect(bytes(Realm.Object.readBytes(attachment, "content", 2, 3))).deep.equals([2, 3, 4]);
+    expect(bytes(Realm.Object.readBytes(attachment, "content", 6, 10))).deep.equals([6, 7]);
+    expect(bytes(Realm.Object.readBytes(attachment, "content", 5))).deep.equals([5, 6, 7]);
+    expect(Realm.Object.readBytes(attachment, "content", 8).byteLength).equals(0);
+    expect(Realm.Object.readBytes(attachment, "content", 20).byteLength).equals(0);
+  });
+
+  it("reads strings as UTF-8 and nulls as empty", function (this: RealmContext) {
+    expect(Realm.Object.byteLength(attachment, "name")).equals(6);
+    expect(bytes(Realm.Object.readBytes(attachment, "name", 1, 2))).deep.equals([0xc3, 0xa9]);
+    this.realm.write(() => {
+      attachment.name = null;
+    });
+    expect(Realm.Object.byteLength(attachment, "name")).equals(0);
+    expect(Realm.Object.readBytes(attachment, "name").byteLength).equals(0);
+  });
+
+  it("writes a value from chunks", function (this: RealmContext) {
+    const size = this.realm.write(() =>
+      Realm.Object.writeBytes(attachment, "content", [new Uint8Array([9, 8]), new Uint8Array([7, 6, 5]).buffer, "A"]),
+    );
+    expect(size).equals(6);
+    expect(bytes(attachment.content as ArrayBuffer)).deep.equals([9, 8, 7, 6, 5, 65]);
+    this.realm.write(() => Realm.Object.writeBytes(attachment, "name", ["hé", "llo"]));
+    expect(attachment.name).equals("héllo");
+  });
+
+  it("writes a value from asynchronous chunks", async function (this: RealmContext) {
+    async function* chunks() {
+      for (let i = 0; i < 4; i++) {
+        yield new Uint8Array(1024).fill(i);
+      }
+    }
+    expect(await Realm.Object.writeBytesAsync(attachment, "content", chunks())).equals(4096);
+    expect(Realm.Object.byteLength(attachment, "content")).equals(4096);
+    expect(bytes(Realm.Object.readBytes(attachment, "content", 1023, 2))).deep.equals([0, 1]);
+  });
+
+  it("throws on other properties and outside of transactions", function (this: RealmContext) {
+    expect(() => Realm.Object.readBytes(attachment, "size")).throws(
+      "Expected 'size' to be a 'data' or 'string' property",
+    );
+    expect(() => Realm.Object.writeBytes(attachment, "content", [])).throws(
+      "Cannot modify managed objects outside of a write transaction.",
+    );
+  });
+
+  it("works for objects with properties of the same names", function (this: RealmContext) {
+    const blob = this.realm.write(() =>
+      this.realm.create<{ content: ArrayBuffer; byteLength: number } & Realm.Object>(BlobSchema.name, {
+        content: new Uint8Array([1, 2, 3]).buffer,
+        byteLength: 3,
+      }),
+    );
+    expect(blob.byteLength).equals(3);
+    expect(Realm.Object.byteLength(blob, "content")).equals(3);
+    expect(bytes(Realm.Object.readBytes(blob, "content", 1))).deep.equals([2, 3]);
+  });
+});
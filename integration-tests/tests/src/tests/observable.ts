@@ -180,7 +180,7 @@ async function expectObjectNotifications<T>(
  */
 async function expectCollectionNotifications(
   collection: Realm.Collection,
-  keyPaths: undefined | string | string[],
+  keyPaths: undefined | string | string[] | Realm.CollectionListenerOptions,
   changesAndActions: (Action | CollectionChangeSet)[],
 ) {
   await expectNotifications(
@@ -889,6 +889,56 @@ describe("Observable", () => {
       await expectCollectionNotifications(this.realm.objects("Person"), ["name"], [EMPTY_COLLECTION_CHANGESET]);
     });
 
+    it("calls listener with object keys", async function (this: RealmObjectContext<Person>) {
+      const collection = this.realm.objects<Person>("Person");
+      const [, bob, charlie] = collection;
+      const bobKey = bob._objectKey();
+      const charlieKey = charlie._objectKey();
+      let dennisKey = "";
+
+      await expectCollectionNotifications(collection, { keyPaths: ["name"], objectKeys: true }, [
+        { ...EMPTY_COLLECTION_CHANGESET, objectKeys: { deletions: [], insertions: [], newModifications: [] } },
+        () => {
+          this.realm.write(() => {
+            this.realm.delete(bob);
+          });
+        },
+        {
+          deletions: [1],
+          insertions: [],
+          newModifications: [],
+          oldModifications: [],
+          objectKeys: { deletions: [bobKey], insertions: [], newModifications: [] },
+        },
+        () => {
+          this.realm.write(() => {
+            charlie.name = "Chuck";
+          });
+        },
+        {
+          deletions: [],
+          insertions: [],
+          newModifications: [1],
+          oldModifications: [1],
+          objectKeys: { deletions: [], insertions: [], newModifications: [charlieKey] },
+        },
+        () => {
+          this.realm.write(() => {
+            dennisKey = this.realm.create<Person>("Person", { name: "Dennis" })._objectKey();
+          });
+        },
+        {
+          deletions: [],
+          insertions: [2],
+          newModifications: [],
+          oldModifications: [],
+          get objectKeys() {
+            return { deletions: [], insertions: [dennisKey], newModifications: [] };
+          },
+        },
+      ]);
+    });
+
     it("calls listener when primitive is updated", async function (this: RealmObjectContext<Person>) {
       const collection = this.realm.objects("Person");
       await expectCollectionNotifications(collection, undefined, [
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+const OrderSchema: Realm.ObjectSchema = {
+  name: "Order",
+  properties: {
+    number: "int",
+    customer: "string",
+    total: "double",
+  },
+};
+
+type Order = { number: number; customer: string; total: number };
+
+function numbers(page: Realm.Page<Order>) {
+  return page.items.map((order) => order.number);
+}
+
+describe("Results#page", () => {
+  openRealmBeforeEach({ schema: [OrderSchema] });
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      for (let number = 0; number < 10; number++) {
+        this.realm.create(OrderSchema.name, { number, customer: number % 2 ? "Bob" : "Alice", total: 100 - number });
+      }
+    });
+  });
+
+  it("pages through results in order", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name).sorted("total");
+    const first = orders.page({ limit: 4 });
+    expect(numbers(first)).deep.equals([9, 8, 7, 6]);
+    expect(first.hasMore).equals(true);
+    const second = orders.page({ after: first.cursor, limit: 4 });
+    expect(numbers(second)).deep.equals([5, 4, 3, 2]);
+    const third = orders.page({ after: second.cursor, limit: 4 });
+    expect(numbers(third)).deep.equals([1, 0]);
+    expect(third.hasMore).equals(false);
+    const empty = orders.page({ after: third.cursor, limit: 4 });
+    expect(empty.items).deep.equals([]);
+    expect(empty.cursor).equals(third.cursor);
+  });
+
+  it("breaks ties between equal values", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name).sorted([["customer", true]]);
+    const seen: number[] = [];
+    let page = orders.page({ limit: 3 });
+    seen.push(...numbers(page));
+    while (page.hasMore) {
+      page = orders.page({ after: page.cursor, limit: 3 });
+      seen.push(...numbers(page));
+    }
+    expect(seen).deep.equals([1, 3, 5, 7, 9, 0, 2, 4, 6, 8]);
+  });
+
+  it("isn't shifted by objects inserted or deleted before the cursor", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name).filtered("number >= 0").sorted("number");
+    const first = orders.page({ limit: 3 });
+    expect(numbers(first)).deep.equals([0, 1, 2]);
+    this.realm.write(() => {
+      this.realm.create(OrderSchema.name, { number: -1, customer: "Charlie", total: 0 });
+      this.realm.delete(orders.filtered("number == 2"));
+      this.realm.create(OrderSchema.name, { number: 1, customer: "Charlie", total: 0 });
+    });
+    expect(numbers(orders.page({ after: first.cursor, limit: 3 }))).deep.equals([3, 4, 5]);
+  });
+
+  it("pages through unsorted results", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name);
+    const first = orders.page({ limit: 6 });
+    expect(numbers(orders.page({ after: first.cursor, limit: 6 }))).deep.equals([6, 7, 8, 9]);
+  });
+
+  it("pages through results sorted within the query", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name).filtered("number >= 0 SORT(total ASC)");
+    const first = orders.page({ limit: 3 });
+    const second = orders.page({ after: first.cursor, limit: 3 });
+    const third = orders.page({ after: second.cursor, limit: 3 });
+    const fourth = orders.page({ after: third.cursor, limit: 3 });
+    expect([first, second, third, fourth].flatMap(numbers)).deep.equals([9, 8, 7, 6, 5, 4, 3, 2, 1, 0]);
+  });
+
+  it("throws on invalid options", function (this: RealmContext) {
+    const orders = this.realm.objects<Order>(OrderSchema.name);
+    expect(() => orders.page({ limit: 0 })).throws("Expected 'limit' to be positive");
+    expect(() => orders.page({ after: "nope", limit: 1 })).throws("Invalid page cursor: 'nope'");
+  });
+});
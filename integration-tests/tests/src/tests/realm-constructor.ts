@@ -397,4 +397,59 @@ describe("Realm#constructor", () => {
       realm.close();
     });
   });
+
+  describe("with schemaFingerprint", () => {
+    it("stores a fingerprint next to the file", () => {
+      const realm = new Realm({ schema: [TestObject], schemaFingerprint: true });
+      const fingerprintPath = realm.path + ".fingerprint";
+      realm.close();
+      expect(fs.exists(fingerprintPath)).equals(true);
+      Realm.deleteFile({});
+      expect(fs.exists(fingerprintPath)).equals(false);
+    });
+
+    it("reopens with an unchanged schema", () => {
+      new Realm({ schema: [TestObject], schemaVersion: 3, schemaFingerprint: true }).close();
+      const realm = new Realm({ schema: [TestObject], schemaVersion: 3, schemaFingerprint: true });
+      expect(realm.schemaVersion).equals(3);
+      expect(realm.schema.map((objectSchema) => objectSchema.name)).deep.equals([TestObject.schema.name]);
+      // Constructors are still applied to the schema read from the file
+      realm.write(() => realm.create(TestObject, { doubleCol: 1 }));
+      expect(realm.objects(TestObject)[0]).instanceOf(TestObject);
+      realm.close();
+    });
+
+    it("migrates when the schema changed", () => {
+      new Realm({ schema: [TestObject], schemaFingerprint: true }).close();
+      const realm = new Realm({
+        schema: [TestObject, PersonSchema, DogSchema],
+        schemaVersion: 1,
+        schemaFingerprint: true,
+      });
+      expect(realm.schema.map((objectSchema) => objectSchema.name).sort()).deep.equals(
+        [DogSchema.name, PersonSchema.name, TestObject.schema.name].sort(),
+      );
+      realm.close();
+    });
+
+    it("ignores a stale fingerprint", () => {
+      new Realm({ schema: [TestObject], schemaFingerprint: true }).close();
+      // Another writer adds an object type without updating the fingerprint
+      new Realm({ schema: [TestObject, PersonSchema, DogSchema], schemaVersion: 0 }).close();
+      const realm = new Realm({ schema: [TestObject], schemaFingerprint: true });
+      expect(realm.schema.map((objectSchema) => objectSchema.name)).contains(TestObject.schema.name);
+      realm.write(() => realm.create(TestObject, { doubleCol: 1 }));
+      realm.close();
+    });
+
+    it("ignores a stale fingerprint with the same object types", () => {
+      new Realm({ schema: [TestObject], schemaFingerprint: true }).close();
+      // Another writer changes the properties, keeping the object types and schema version
+      new Realm({
+        schema: [{ name: TestObject.schema.name, properties: { stringCol: "string" } }],
+        deleteRealmIfMigrationNeeded: true,
+      }).close();
+      expect(() => new Realm({ schema: [TestObject], schemaFingerprint: true })).throws("Migration is required");
+    });
+  });
 });
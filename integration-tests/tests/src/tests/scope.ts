@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  properties: {
+    name: "string",
+    friends: "Person[]",
+  },
+};
+
+type Person = { name: string; friends: Realm.List<Person> };
+
+describe("Realm#scope", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      const alice = this.realm.create<Person>(PersonSchema.name, { name: "Alice" });
+      this.realm.create<Person>(PersonSchema.name, { name: "Bob", friends: [alice] });
+    });
+  });
+
+  it("returns the value returned by the callback", function (this: RealmContext) {
+    const names = this.realm.scope(() => this.realm.objects<Person>(PersonSchema.name).map((person) => person.name));
+    expect(names).deep.equals(["Alice", "Bob"]);
+  });
+
+  it("releases collections and objects when the callback returns", function (this: RealmContext) {
+    const { people, bob, friends } = this.realm.scope(() => {
+      const people = this.realm.objects<Person>(PersonSchema.name);
+      const bob = people.filtered("name == 'Bob'")[0];
+      return { people, bob, friends: bob.friends };
+    });
+    expect(() => people.length).throws("Results has been released and can no longer be used");
+    expect(() => bob.name).throws("Obj has been released and can no longer be used");
+    expect(() => friends.length).throws("has been released and can no longer be used");
+  });
+
+  it("keeps what was created outside of the scope", function (this: RealmContext) {
+    const people = this.realm.objects<Person>(PersonSchema.name);
+    const alice = people[0];
+    this.realm.scope(() => {
+      expect(people.length).equals(2);
+      expect(alice.name).equals("Alice");
+    });
+    expect(people.length).equals(2);
+    expect(alice.name).equals("Alice");
+  });
+
+  it("releases when the callback throws", function (this: RealmContext) {
+    let people: Realm.Results<Person> | undefined;
+    expect(() =>
+      this.realm.scope(() => {
+        people = this.realm.objects<Person>(PersonSchema.name);
+        throw new Error("boom");
+      }),
+    ).throws("boom");
+    expect(() => people?.length).throws("Results has been released and can no longer be used");
+  });
+
+  it("releases what an inner scope created when it returns", function (this: RealmContext) {
+    this.realm.scope(() => {
+      const people = this.realm.objects<Person>(PersonSchema.name);
+      const inner = this.realm.scope(() => people.filtered("name == 'Alice'"));
+      expect(() => inner.length).throws("Results has been released and can no longer be used");
+      expect(people.length).equals(2);
+    });
+  });
+
+  it("releases when the promise returned settles", async function (this: RealmContext) {
+    let people: Realm.Results<Person> | undefined;
+    const length = await this.realm.scope(async () => {
+      people = this.realm.objects<Person>(PersonSchema.name);
+      await new Promise((resolve) => setTimeout(resolve, 1));
+      return people.length;
+    });
+    expect(length).equals(2);
+    expect(() => people?.length).throws("Results has been released and can no longer be used");
+  });
+
+  it.skipIf(
+    environment.reactNative,
+    "releases what was created after the callback awaits",
+    async function (this: RealmContext) {
+      let people: Realm.Results<Person> | undefined;
+      await this.realm.scope(async () => {
+        await new Promise((resolve) => setTimeout(resolve, 1));
+        people = this.realm.objects<Person>(PersonSchema.name);
+      });
+      expect(() => people?.length).throws("Results has been released and can no longer be used");
+    },
+  );
+});
@@ -409,6 +409,57 @@ describe("Sets", () => {
     });
   });
 
+  describe("Set algebra", () => {
+    openRealmBeforeEach({ schema: [teamSchema] });
+
+    function createTeams(this: RealmContext) {
+      return this.realm.write(() => [
+        this.realm.create<Team>(teamSchema.name, { names: ["Alice", "Bob", "Charlie"] }),
+        this.realm.create<Team>(teamSchema.name, { names: ["Bob", "Charlie", "Dave"] }),
+      ]);
+    }
+
+    it("tests relations with Sets and arrays", function (this: RealmContext) {
+      const [first, second] = createTeams.call(this);
+      expect(first.names.intersects(second.names)).equals(true);
+      expect(first.names.isSubsetOf(second.names)).equals(false);
+      expect(first.names.isSubsetOf(["Alice", "Bob", "Charlie", "Eve"])).equals(true);
+      expect(first.names.isSupersetOf(["Bob", "Bob", "Alice"])).equals(true);
+      expect(first.names.isSupersetOf(["Bob", "Eve"])).equals(false);
+      expect(first.names.intersects(["Eve"])).equals(false);
+      expect(first.names.intersects([])).equals(false);
+    });
+
+    it("combines Sets and arrays without modifying the Set", function (this: RealmContext) {
+      const [first, second] = createTeams.call(this);
+      expect(first.names.union(second.names).sort()).deep.equals(["Alice", "Bob", "Charlie", "Dave"]);
+      expect(first.names.intersection(second.names).sort()).deep.equals(["Bob", "Charlie"]);
+      expect(first.names.difference(second.names)).deep.equals(["Alice"]);
+      expect(first.names.symmetricDifference(["Alice", "Eve", "Eve"]).sort()).deep.equals(["Bob", "Charlie", "Eve"]);
+      expect(first.names.size).equals(3);
+    });
+
+    it("updates the Set in place", function (this: RealmContext) {
+      const [first, second] = createTeams.call(this);
+      this.realm.write(() => {
+        first.names.formUnion(second.names);
+      });
+      expect([...first.names].sort()).deep.equals(["Alice", "Bob", "Charlie", "Dave"]);
+      this.realm.write(() => {
+        first.names.subtract(["Alice", "Eve"]);
+        first.names.formIntersection(["Bob", "Dave", "Eve"]);
+      });
+      expect([...first.names].sort()).deep.equals(["Bob", "Dave"]);
+      this.realm.write(() => {
+        first.names.formSymmetricDifference(second.names);
+      });
+      expect([...first.names].sort()).deep.equals(["Charlie"]);
+      expect(() => first.names.formUnion(["Eve"])).throws(
+        "Cannot modify managed objects outside of a write transaction.",
+      );
+    });
+  });
+
   describe("toJSON serialization", () => {
     it("should serialize sets of objects correctly", () => {
       const myInts = [1, 2, 3, 7, 9, 13];
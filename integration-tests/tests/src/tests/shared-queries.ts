@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+import { createPromiseHandle } from "../utils/promise-handle";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  properties: {
+    name: "string",
+    age: "int",
+  },
+};
+
+type Person = { name: string; age: number };
+
+function listen(collection: Realm.Results<Person>, keyPaths?: string[]) {
+  const changes: Realm.CollectionChangeSet[] = [];
+  let handle = createPromiseHandle();
+  const callback = (_: unknown, change: Realm.CollectionChangeSet) => {
+    changes.push(change);
+    handle.resolve();
+  };
+  collection.addListener(callback, keyPaths);
+  return {
+    changes,
+    callback,
+    async next() {
+      await handle;
+      handle = createPromiseHandle();
+    },
+  };
+}
+
+describe("Configuration#shareQueries", () => {
+  openRealmBeforeEach({ schema: [PersonSchema], shareQueries: true });
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice", age: 30 });
+    });
+  });
+
+  it("notifies every listener on identical queries", async function (this: RealmContext) {
+    const first = listen(this.realm.objects<Person>(PersonSchema.name).filtered("age > $0", 18).sorted("name"));
+    const second = listen(this.realm.objects<Person>(PersonSchema.name).filtered("age > $0", 18).sorted("name"));
+    await Promise.all([first.next(), second.next()]);
+
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Bob", age: 40 });
+    });
+    await Promise.all([first.next(), second.next()]);
+    expect(first.changes).deep.equals(second.changes);
+    expect(first.changes[1].insertions).deep.equals([1]);
+  });
+
+  it("notifies a listener added later once it has been added", async function (this: RealmContext) {
+    const first = listen(this.realm.objects<Person>(PersonSchema.name));
+    await first.next();
+    const second = listen(this.realm.objects<Person>(PersonSchema.name));
+    await second.next();
+    expect(second.changes).deep.equals([{ deletions: [], insertions: [], oldModifications: [], newModifications: [] }]);
+    expect(first.changes).has.length(1);
+  });
+
+  it("keeps notifying the remaining listeners", async function (this: RealmContext) {
+    const persons = this.realm.objects<Person>(PersonSchema.name);
+    const first = listen(persons);
+    const second = listen(this.realm.objects<Person>(PersonSchema.name));
+    await Promise.all([first.next(), second.next()]);
+    persons.removeListener(first.callback);
+
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Bob", age: 40 });
+    });
+    await second.next();
+    expect(second.changes[1].insertions).deep.equals([1]);
+    expect(first.changes).has.length(1);
+  });
+
+  it("doesn't share queries with different arguments", async function (this: RealmContext) {
+    const adults = listen(this.realm.objects<Person>(PersonSchema.name).filtered("age > $0", 18));
+    const seniors = listen(this.realm.objects<Person>(PersonSchema.name).filtered("age > $0", 65));
+    await Promise.all([adults.next(), seniors.next()]);
+
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Carol", age: 70 });
+      this.realm.create(PersonSchema.name, { name: "Dave", age: 20 });
+    });
+    await Promise.all([adults.next(), seniors.next()]);
+    expect(adults.changes[1].insertions).deep.equals([1, 2]);
+    expect(seniors.changes[1].insertions).deep.equals([0]);
+  });
+
+  it("notifies listeners with key paths separately", async function (this: RealmContext) {
+    const all = listen(this.realm.objects<Person>(PersonSchema.name));
+    const names = listen(this.realm.objects<Person>(PersonSchema.name), ["name"]);
+    await Promise.all([all.next(), names.next()]);
+
+    const [alice] = this.realm.objects<Person>(PersonSchema.name);
+    this.realm.write(() => {
+      alice.age = 31;
+    });
+    await all.next();
+    expect(all.changes[1].newModifications).deep.equals([0]);
+    expect(names.changes).has.length(1);
+  });
+});
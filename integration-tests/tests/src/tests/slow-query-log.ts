@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+import { createPromiseHandle } from "../utils/promise-handle";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  primaryKey: "name",
+  properties: {
+    name: "string",
+    age: { type: "int", indexed: true },
+    city: { type: "string", mapTo: "_city" },
+  },
+};
+
+describe("Realm#startSlowQueryLog", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  beforeEach(function (this: RealmContext) {
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice", age: 30, city: "Copenhagen" });
+      this.realm.create(PersonSchema.name, { name: "Bob", age: 40, city: "Aarhus" });
+    });
+  });
+
+  it("reports filters, sorts and aggregates above the threshold", function (this: RealmContext) {
+    const reported: Realm.SlowQuery[] = [];
+    this.realm.startSlowQueryLog({ thresholdMs: 0, onSlowQuery: (query) => reported.push(query) });
+    const persons = this.realm.objects(PersonSchema.name);
+    const adults = persons.filtered("age >= 18");
+    adults.sorted("name");
+    adults.sum("age");
+
+    expect(reported.map(({ kind }) => kind)).deep.equals(["filter", "sort", "aggregate"]);
+    const [filter, sort, aggregate] = reported;
+    expect(filter.objectType).equals(PersonSchema.name);
+    expect(filter.description).contains("age >= 18");
+    expect(filter.size).equals(2);
+    expect(filter.elapsedMs).to.be.at.least(0);
+    expect(filter.indexedProperties).deep.equals(["age"]);
+    expect(sort.description).contains("SORT(name ASC)");
+    expect(sort.indexedProperties).deep.equals(["name", "age"]);
+    expect(aggregate.aggregate).equals("sum(age)");
+  });
+
+  it("ignores property names in string literals", function (this: RealmContext) {
+    const reported: Realm.SlowQuery[] = [];
+    this.realm.startSlowQueryLog({ thresholdMs: 0, onSlowQuery: (query) => reported.push(query) });
+    this.realm.objects(PersonSchema.name).filtered("city == 'age'");
+    expect(reported).has.length(1);
+    expect(reported[0].indexedProperties).deep.equals([]);
+  });
+
+  it("doesn't report below the threshold or once stopped", function (this: RealmContext) {
+    const reported: Realm.SlowQuery[] = [];
+    this.realm.startSlowQueryLog({ thresholdMs: 60_000, onSlowQuery: (query) => reported.push(query) });
+    this.realm.objects(PersonSchema.name).filtered("age >= 18").sum("age");
+    expect(reported).deep.equals([]);
+
+    this.realm.startSlowQueryLog({ thresholdMs: 0, onSlowQuery: (query) => reported.push(query) });
+    this.realm.stopSlowQueryLog();
+    this.realm.objects(PersonSchema.name).filtered("age >= 18");
+    expect(reported).deep.equals([]);
+  });
+
+  it("reports collection listeners", async function (this: RealmContext) {
+    const reported: Realm.SlowQuery[] = [];
+    this.realm.startSlowQueryLog({ thresholdMs: 0, onSlowQuery: (query) => reported.push(query) });
+    const handle = createPromiseHandle();
+    const persons = this.realm.objects(PersonSchema.name);
+    persons.addListener(() => handle.resolve());
+    await handle;
+    persons.removeAllListeners();
+    expect(reported.map(({ kind }) => kind)).deep.equals(["listener"]);
+    expect(reported[0].size).equals(2);
+  });
+
+  it("throws on invalid options", function (this: RealmContext) {
+    // @ts-expect-error Testing a missing threshold
+    expect(() => this.realm.startSlowQueryLog({})).throws("Expected 'thresholdMs' to be a number");
+    expect(() => this.realm.startSlowQueryLog({ thresholdMs: -1 })).throws(
+      "Expected 'thresholdMs' to be zero or positive",
+    );
+  });
+});
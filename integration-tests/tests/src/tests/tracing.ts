@@ -0,0 +1,115 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import Realm from "realm";
+import { openRealmBeforeEach } from "../hooks";
+import { createPromiseHandle } from "../utils/promise-handle";
+
+const PersonSchema: Realm.ObjectSchema = {
+  name: "Person",
+  properties: {
+    name: "string",
+  },
+};
+
+type TraceEvent = { name: string; cat?: string; ph: string; ts?: number; dur?: number; args?: Record<string, string> };
+
+function parseTrace(json: string) {
+  const { traceEvents, otherData } = JSON.parse(json) as { traceEvents: TraceEvent[]; otherData: object };
+  return { events: traceEvents.filter(({ ph }) => ph === "X"), otherData };
+}
+
+describe("Tracing", () => {
+  openRealmBeforeEach({ schema: [PersonSchema] });
+
+  afterEach(() => {
+    // Stops tracing left running by a failing test
+    try {
+      Realm.stopTracing();
+    } catch {
+      // Tracing wasn't running
+    }
+  });
+
+  it("records write transactions", function (this: RealmContext) {
+    Realm.startTracing();
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice" });
+    });
+    const { events, otherData } = parseTrace(Realm.stopTracing());
+    const writes = events.filter(({ cat }) => cat === "write").map(({ name }) => name);
+    expect(writes).deep.equals(["beginTransaction", "commitTransaction"]);
+    for (const { ts, dur } of events) {
+      expect(ts).to.be.a("number");
+      expect(dur).to.be.at.least(0);
+    }
+    expect(otherData).deep.equals({ droppedEvents: 0 });
+  });
+
+  it("records calls into the binding", function (this: RealmContext) {
+    Realm.startTracing();
+    expect(this.realm.objects(PersonSchema.name).length).equals(0);
+    const { events } = parseTrace(Realm.stopTracing());
+    const calls = events.filter(({ cat }) => cat === "binding").map(({ name }) => name);
+    expect(calls).contains("Results.size");
+  });
+
+  it("doesn't record calls into the binding when disabled", function (this: RealmContext) {
+    Realm.startTracing({ bindingCalls: false });
+    this.realm.write(() => {
+      this.realm.create(PersonSchema.name, { name: "Alice" });
+    });
+    const { events } = parseTrace(Realm.stopTracing());
+    expect(events.filter(({ cat }) => cat === "binding")).deep.equals([]);
+    expect(events.filter(({ cat }) => cat === "write")).has.length(2);
+  });
+
+  it("records change listeners", async function (this: RealmContext) {
+    const persons = this.realm.objects(PersonSchema.name);
+    const handle = createPromiseHandle();
+    Realm.startTracing();
+    persons.addListener(() => handle.resolve());
+    await handle;
+    persons.removeAllListeners();
+    const { events } = parseTrace(Realm.stopTracing());
+    const callbacks = events.filter(({ cat }) => cat === "notification");
+    expect(callbacks.map(({ args }) => args?.detail)).deep.equals([PersonSchema.name]);
+  });
+
+  it("counts the events dropped from full buffers", function (this: RealmContext) {
+    Realm.startTracing({ eventsPerThread: 1, bindingCalls: false });
+    for (let i = 0; i < 3; i++) {
+      this.realm.write(() => {
+        this.realm.create(PersonSchema.name, { name: "Alice" });
+      });
+    }
+    const { events, otherData } = parseTrace(Realm.stopTracing());
+    expect(events).has.length(1);
+    expect(otherData).deep.equals({ droppedEvents: 5 });
+  });
+
+  it("throws when started twice or stopped without being started", function () {
+    expect(() => Realm.stopTracing()).throws("Tracing has not been started");
+    Realm.startTracing();
+    expect(() => Realm.startTracing()).throws("Tracing has already been started");
+    expect(() => Realm.startTracing({ eventsPerThread: 0 })).throws("Tracing has already been started");
+    Realm.stopTracing();
+    expect(() => Realm.startTracing({ eventsPerThread: 0 })).throws("Expected 'eventsPerThread' to be positive");
+  });
+});
@@ -20,6 +20,10 @@
 
 interface fs {
   exists: (path: string) => boolean;
+  /** Only available on platforms with access to the file system of the host running the tests */
+  readFile?: (path: string) => string;
+  /** Only available on platforms with access to the file system of the host running the tests */
+  writeFile?: (path: string, contents: string) => void;
 }
 
 interface path {
@@ -36,6 +40,14 @@ type KnownEnvironment = {
   mongodbServiceType?: "mongodb" | "mongodb-atlas";
   /** Run the performance tests (skipped by default) */
   performance?: true;
+  /** Maximum time in milliseconds to spend on a single performance test. */
+  performanceMaxTime?: string;
+  /** Path of a file to write the JSON report of the performance tests to. Logged to the console if not set. */
+  performanceOutput?: string;
+  /** Path of a JSON report from a previous run of the performance tests, to compare the results against. */
+  performanceBaseline?: string;
+  /** Percentage by which a performance test may be slower than its baseline before failing. Defaults to 10. */
+  performanceThreshold?: string;
   /** Disable deletion of the Realm app after the test run. */
   preserveAppAfterRun?: true;
   /** Instructs the app importer to reuse and reconfigure a single app. */
@@ -26,26 +26,132 @@ const maxTimeMs = parseInt(typeof performanceMaxTime === "string" ? performanceM
 
 const DEFAULT_OPTIONS: Partial<BenchmarkOpts> = { output: false, iter: 1000, size: 1000 };
 
+/** Percentage by which a benchmark may be slower than its baseline before it's considered a regression. */
+const DEFAULT_REGRESSION_THRESHOLD = 10;
+
 type BenchmarkContext = {
   result: BenchmarkResult;
 } & Mocha.Context;
 
+/**
+ * Machine readable result of a single benchmark.
+ */
+export type BenchmarkReportEntry = {
+  opsPerSec: number;
+  /** Mean duration of an iteration in milliseconds */
+  mean: number;
+  /** Standard deviation, relative to the mean in percent */
+  sd: number;
+  iter: number;
+  size: number;
+};
+
+export type BenchmarkReport = {
+  title: string;
+  date: string;
+  /** Results keyed by the full title of the benchmark */
+  results: Record<string, BenchmarkReportEntry>;
+};
+
+export type BenchmarkRegression = {
+  title: string;
+  baseline: number;
+  current: number;
+  /** How much slower the current result is, in percent */
+  change: number;
+};
+
+const results: Record<string, BenchmarkReportEntry> = {};
+
+function recordResult(test: Mocha.Runnable, entry: BenchmarkReportEntry) {
+  results[test.fullTitle()] = entry;
+  const ops = entry.opsPerSec.toLocaleString("en-US", {
+    maximumFractionDigits: 0,
+  });
+  test.title += ` (${ops} ops/sec, ±${entry.sd}%)`;
+}
+
 export function itPerforms(title: string, fn: () => void, options?: Partial<BenchmarkOpts>): void {
   it(title, async function (this: Partial<BenchmarkContext> & Mocha.Context) {
     const { benchmark } = await import("@thi.ng/bench");
     this.timeout("1m").slow("1m");
     const result = benchmark(fn.bind(this), { ...DEFAULT_OPTIONS, ...options });
     const hz = (result.iter * result.size) / (result.total / 1000);
-    const ops = hz.toLocaleString("en-US", {
-      maximumFractionDigits: 0,
-    });
-    const sd = Number(result.sd.toFixed(2));
     // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
-    this.test!.title += ` (${ops} ops/sec, ±${sd}%)`;
+    recordResult(this.test!, {
+      opsPerSec: hz,
+      mean: result.mean,
+      sd: Number(result.sd.toFixed(2)),
+      iter: result.iter,
+      size: result.size,
+    });
     this.result = result;
   });
 }
 
+type AsyncBenchmarkOptions = {
+  /** Number of iterations to measure */
+  iter: number;
+  /** Number of iterations to run before measuring */
+  warmup: number;
+  /** Number of operations performed by each iteration */
+  size: number;
+};
+
+/**
+ * Like {@link itPerforms}, but awaiting each iteration, which makes it suitable for measuring notifications.
+ * The {@link prepare} function is called before each iteration and isn't measured.
+ */
+export function itPerformsAsync<T>(
+  title: string,
+  prepare: (this: Mocha.Context) => T | Promise<T>,
+  fn: (this: Mocha.Context, prepared: T) => Promise<void>,
+  options: Partial<AsyncBenchmarkOptions> = {},
+): void {
+  itPerformsMeasured(
+    title,
+    async function (this: Mocha.Context) {
+      const prepared = await prepare.call(this);
+      const start = performance.now();
+      await fn.call(this, prepared);
+      return performance.now() - start;
+    },
+    options,
+  );
+}
+
+/**
+ * Like {@link itPerformsAsync}, but for operations which can't be timed by wrapping them, such as loading a module in
+ * a new process. Each iteration resolves to the duration it measured, in milliseconds.
+ */
+export function itPerformsMeasured(
+  title: string,
+  measure: (this: Mocha.Context) => Promise<number>,
+  { iter = 20, warmup = 2, size = 1 }: Partial<AsyncBenchmarkOptions> = {},
+): void {
+  it(title, async function (this: Mocha.Context) {
+    this.timeout("1m").slow("1m");
+    const durations: number[] = [];
+    for (let i = 0; i < warmup + iter; i++) {
+      const duration = await measure.call(this);
+      if (i >= warmup) {
+        durations.push(duration);
+      }
+    }
+    const total = durations.reduce((sum, duration) => sum + duration, 0);
+    const mean = total / iter;
+    const variance = durations.reduce((sum, duration) => sum + (duration - mean) ** 2, 0) / iter;
+    // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
+    recordResult(this.test!, {
+      opsPerSec: (iter * size) / (total / 1000),
+      mean,
+      sd: Number(((Math.sqrt(variance) / mean) * 100).toFixed(2)),
+      iter,
+      size,
+    });
+  });
+}
+
 type PerformanceTestParameters = {
   benchmarkTitle: string;
   // Schema to use when opening the Realm
@@ -54,6 +160,8 @@ type PerformanceTestParameters = {
   before(this: RealmContext): void;
   // Perform the actual test
   test(this: RealmObjectContext): void;
+  // Options passed to the benchmark
+  options?: Partial<BenchmarkOpts>;
 };
 
 export function describePerformance(title: string, parameters: PerformanceTestParameters): void {
@@ -62,9 +170,85 @@ export function describePerformance(title: string, parameters: PerformanceTestPa
       schema: parameters.schema,
     });
     before(parameters.before);
-    itPerforms(parameters.benchmarkTitle, parameters.test);
+    itPerforms(parameters.benchmarkTitle, parameters.test, parameters.options);
     after(function (this: BenchmarkContext) {
       // console.log(this.summary);
     });
   });
 }
+
+/**
+ * @returns A report of all benchmarks which ran so far.
+ */
+export function createBenchmarkReport(): BenchmarkReport {
+  return {
+    title: typeof title === "string" ? title : "Unknown environment",
+    date: new Date().toISOString(),
+    results: { ...results },
+  };
+}
+
+/**
+ * Compare a report against a baseline report.
+ * Benchmarks missing from either report are ignored.
+ * @param threshold Percentage by which a benchmark may be slower than its baseline.
+ * @returns The benchmarks which got slower than the threshold allows.
+ */
+export function findRegressions(
+  report: BenchmarkReport,
+  baseline: BenchmarkReport,
+  threshold = DEFAULT_REGRESSION_THRESHOLD,
+): BenchmarkRegression[] {
+  const regressions: BenchmarkRegression[] = [];
+  for (const [title, { opsPerSec: current }] of Object.entries(report.results)) {
+    const baselineEntry = baseline.results[title];
+    if (baselineEntry) {
+      const change = ((baselineEntry.opsPerSec - current) / baselineEntry.opsPerSec) * 100;
+      if (change > threshold) {
+        regressions.push({ title, baseline: baselineEntry.opsPerSec, current, change });
+      }
+    }
+  }
+  return regressions;
+}
+
+/**
+ * Emit the report of all benchmarks which ran so far and fail if any regressed compared to a baseline.
+ *
+ * Controlled via the context:
+ * - `performanceOutput`: Path of a file to write the JSON report to. Logged to the console if not set.
+ * - `performanceBaseline`: Path of a JSON report (as written by a previous run) to compare against.
+ * - `performanceThreshold`: Percentage by which a benchmark may be slower than its baseline. Defaults to 10.
+ */
+export function reportBenchmarks(): void {
+  const report = createBenchmarkReport();
+  if (Object.keys(report.results).length === 0) {
+    return;
+  }
+  const { performanceOutput, performanceBaseline, performanceThreshold } = environment;
+  const json = JSON.stringify(report, null, 2);
+  if (typeof performanceOutput === "string") {
+    if (!fs.writeFile) {
+      throw new Error("Writing the performance report is not supported in this environment");
+    }
+    fs.writeFile(performanceOutput, json);
+  } else {
+    console.log(json);
+  }
+  if (typeof performanceBaseline === "string") {
+    if (!fs.readFile) {
+      throw new Error("Reading a performance baseline is not supported in this environment");
+    }
+    const baseline = JSON.parse(fs.readFile(performanceBaseline)) as BenchmarkReport;
+    const threshold =
+      typeof performanceThreshold === "string" ? parseFloat(performanceThreshold) : DEFAULT_REGRESSION_THRESHOLD;
+    const regressions = findRegressions(report, baseline, threshold);
+    if (regressions.length > 0) {
+      const lines = regressions.map(
+        ({ title, baseline, current, change }) =>
+          `- ${title}: ${current.toFixed(0)} ops/sec (baseline ${baseline.toFixed(0)} ops/sec, ${change.toFixed(1)}% slower)`,
+      );
+      throw new Error(`Performance regressed by more than ${threshold}%:\n${lines.join("\n")}`);
+    }
+  }
+}
@@ -294,9 +294,7 @@ describe.each`
     expect(itemRenderCounter).toHaveBeenCalledTimes(11);
   });
 
-  // TODO:  This is a known issue that we have to live with until it is possible
-  // to retrieve the objectId from a deleted object in a listener callback
-  it.skip("handles deletions", async () => {
+  it("handles deletions", async () => {
     const { getByTestId, collection } = await setupTest({ queryType });
 
     const firstItem = collection[0];
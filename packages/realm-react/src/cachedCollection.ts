@@ -154,29 +154,30 @@ export function createCachedCollection<T extends Realm.Object<any>>({
 
   const listenerCallback: CollectionCallback = (listenerCollection, changes) => {
     if (changes.deletions.length > 0 || changes.insertions.length > 0 || changes.newModifications.length > 0) {
-      // TODO: There is currently no way to rebuild the cache key from the changes array for deleted object.
-      // Until it is possible, we clear the cache on deletions.
-      // Blocking issue: https://github.com/realm/realm-core/issues/5220
-
-      // Possible solutions:
-      // a. the listenerCollection is a frozen copy of the collection before the deletion,
-      // allowing accessing the _objectKey() using listenerCollection[index]._objectKey()
-      // b. the callback provides an array of changed objectIds
-
-      if (changes.deletions.length > 0) {
-        objectCache.clear();
-      }
+      const { objectKeys } = changes;
+      if (objectKeys) {
+        // Only the deleted and modified objects need new instances, inserted objects can't be cached yet
+        for (const objectId of objectKeys.deletions) {
+          objectCache.delete(getCacheKey(objectId));
+        }
+        for (const objectId of objectKeys.newModifications) {
+          objectCache.delete(getCacheKey(objectId));
+        }
+      } else {
+        // Without the object keys, there is no way to rebuild the cache key of a deleted object,
+        // so we clear the cache on deletions.
+        if (changes.deletions.length > 0) {
+          objectCache.clear();
+        }
 
-      // Item(s) were modified, just clear them from the cache so that we return new instances for them
-      changes.newModifications.forEach((index) => {
-        const objectId = listenerCollection[index]._objectKey();
-        if (objectId) {
-          const cacheKey = getCacheKey(objectId);
-          if (objectCache.has(cacheKey)) {
-            objectCache.delete(cacheKey);
+        // Item(s) were modified, just clear them from the cache so that we return new instances for them
+        changes.newModifications.forEach((index) => {
+          const objectId = listenerCollection[index]._objectKey();
+          if (objectId) {
+            objectCache.delete(getCacheKey(objectId));
           }
-        }
-      });
+        });
+      }
       updatedRef.current = true;
       updateCallback();
     }
@@ -188,10 +189,10 @@ export function createCachedCollection<T extends Realm.Object<any>>({
     // see https://github.com/realm/realm-js/issues/4375
     if (realm.isInTransaction) {
       setImmediateId = setImmediate(() => {
-        collection.addListener(listenerCallback, keyPaths);
+        collection.addListener(listenerCallback, { keyPaths, objectKeys: true });
       });
     } else {
-      collection.addListener(listenerCallback, keyPaths);
+      collection.addListener(listenerCallback, { keyPaths, objectKeys: true });
     }
   }
 
@@ -33,6 +33,7 @@ import { strict as assert } from "assert";
 
 export function doJsPasses(spec: BoundSpec) {
   addSharedPtrMethods(spec);
+  addReleaseMethods(spec);
   spec.applyOptInList();
   return spec;
 }
@@ -70,6 +71,28 @@ function addSharedPtrMethods(spec: BoundSpec) {
   }
 }
 
+function addReleaseMethods(spec: BoundSpec) {
+  for (const cls of spec.classes) {
+    if (cls.abstract) continue;
+    // Releases the native state of a wrapper before it is garbage collected, by resetting the shared_ptr or
+    // replacing the value with a default constructed one. The wrapper drops its external pointer afterwards.
+    cls.addMethod(
+      new CustomInstanceMethod(
+        cls,
+        "$release",
+        new Func(spec.types.void, [], /*const*/ false, /*noexcept*/ true, /*offthread*/ false),
+        ({ self }) => {
+          if (cls.sharedPtrWrapped) {
+            assert(self.includes("**"));
+            return `${self.replace("**", "*")}.reset()`;
+          }
+          return `${self} = std::decay_t<decltype(${self})>()`;
+        },
+      ),
+    );
+  }
+}
+
 class CustomProperty extends Property {
   constructor(
     on: Class,
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace realm::js {
+
+/**
+ * Call counters and a log-scale latency histogram for a single generated binding function.
+ */
+struct BindingCallStats {
+    // Bucket i counts calls that took [2^i, 2^(i+1)) nanoseconds. The last bucket also counts anything slower.
+    static constexpr size_t num_buckets = 40;
+
+    explicit BindingCallStats(const char* name)
+        : name(name)
+    {
+    }
+
+    void record(uint64_t ns) noexcept
+    {
+        const size_t bucket = ns == 0 ? 0 : std::bit_width(ns) - 1;
+        calls.fetch_add(1, std::memory_order_relaxed);
+        total_ns.fetch_add(ns, std::memory_order_relaxed);
+        histogram[bucket < num_buckets ? bucket : num_buckets - 1].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void reset() noexcept
+    {
+        calls.store(0, std::memory_order_relaxed);
+        total_ns.store(0, std::memory_order_relaxed);
+        for (auto& bucket : histogram) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const char* const name;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::array<std::atomic<uint64_t>, num_buckets> histogram{};
+};
+
+/**
+ * Process-wide registry of the stats for every generated binding function that has been called at least once.
+ * Recording is off by default and only costs a relaxed load per call while disabled.
+ */
+class BindingStats {
+public:
+    static bool is_enabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static void set_enabled(bool enabled) noexcept
+    {
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    // Expected to be called once per function, to initialize a function-local static.
+    static BindingCallStats& register_function(const char* name)
+    {
+        std::lock_guard lock(s_mutex);
+        // Using a deque since it never moves its elements, which keeps the returned reference valid.
+        return s_entries.emplace_back(name);
+    }
+
+    template <typename Func>
+    static void for_each(Func&& func)
+    {
+        std::lock_guard lock(s_mutex);
+        for (const auto& entry : s_entries) {
+            func(entry);
+        }
+    }
+
+    static void reset() noexcept
+    {
+        std::lock_guard lock(s_mutex);
+        for (auto& entry : s_entries) {
+            entry.reset();
+        }
+    }
+
+private:
+    static inline std::atomic<bool> s_enabled{false};
+    static inline std::mutex s_mutex;
+    static inline std::deque<BindingCallStats> s_entries;
+};
+
+/**
+ * Records the duration of its own lifetime into a BindingCallStats, if recording was enabled when it was created.
+ */
+class BindingCallTimer {
+public:
+    explicit BindingCallTimer(BindingCallStats& stats) noexcept
+        : m_stats(BindingStats::is_enabled() ? &stats : nullptr)
+    {
+        if (m_stats)
+            m_start = clock::now();
+    }
+
+    ~BindingCallTimer()
+    {
+        if (m_stats) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - m_start);
+            m_stats->record(uint64_t(elapsed.count()));
+        }
+    }
+
+    BindingCallTimer(const BindingCallTimer&) = delete;
+    BindingCallTimer& operator=(const BindingCallTimer&) = delete;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    BindingCallStats* const m_stats;
+    clock::time_point m_start;
+};
+
+} // namespace realm::js
@@ -103,6 +103,14 @@ REALM_NOINLINE inline jsi::Value toJsiException(jsi::Runtime& env, const std::ex
         catch (const jsi::JSError& e) {
             return e;
         }
+        catch (const std::system_error& e) {
+            // keep the error code, such that callers can tell file system errors apart
+            auto out = jsi::JSError(env, e.what());
+            auto error = out.value().getObject(env);
+            error.setProperty(env, "code", e.code().value());
+            error.setProperty(env, "category", e.code().category().name());
+            return out;
+        }
         catch (const std::exception& e) {
             return jsi::JSError(env, e.what());
         }
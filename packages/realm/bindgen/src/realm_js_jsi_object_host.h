@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <realm/db.hpp>
+#include <realm/obj.hpp>
+#include <realm/object-store/property.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace realm::js::JSI {
+namespace {
+
+namespace jsi = facebook::jsi;
+
+/**
+ * The properties of an object type which ObjectHost reads and writes directly, shared by all objects of the type.
+ */
+struct ObjectHostLayout : jsi::HostObject {
+    struct Field {
+        jsi::PropNameID name;
+        ColKey column;
+        PropertyType type;
+        bool writable;
+    };
+
+    // Names are compared by identity first, which is what makes the lookup cheap on engines interning them.
+    const Field* find(jsi::Runtime& rt, const jsi::PropNameID& name) const
+    {
+        for (const auto& field : fields) {
+            if (jsi::PropNameID::compare(rt, field.name, name))
+                return &field;
+        }
+        return nullptr;
+    }
+
+    std::vector<Field> fields;
+    // Every property of the object type, including those read through the companion object.
+    std::vector<jsi::PropNameID> property_names;
+};
+
+/**
+ * Exposes a Realm object as a host object, reading and writing the properties in its layout straight from the Obj.
+ * Everything else, including methods, symbols and properties of other types, is forwarded to the companion object,
+ * which is the regular RealmObject wrapping the same Obj. Whenever the fast path can't produce exactly what the
+ * companion would (e.g. the object is invalidated or a value would need converting), it forwards too, such that
+ * the companion produces the errors.
+ */
+class ObjectHost final : public jsi::HostObject {
+public:
+    ObjectHost(std::shared_ptr<const ObjectHostLayout> layout, Obj obj, jsi::Object companion)
+        : m_layout(std::move(layout))
+        , m_obj(std::move(obj))
+        , m_companion(std::move(companion))
+    {
+    }
+
+    jsi::Value get(jsi::Runtime& rt, const jsi::PropNameID& name) override
+    {
+        if (auto field = m_layout->find(rt, name); field && m_obj.is_valid())
+            return read(rt, *field);
+        return m_companion.getProperty(rt, name);
+    }
+
+    void set(jsi::Runtime& rt, const jsi::PropNameID& name, const jsi::Value& value) override
+    {
+        if (auto field = m_layout->find(rt, name); field && field->writable && is_writable() && write(rt, *field, value))
+            return;
+        m_companion.setProperty(rt, name, value);
+    }
+
+    std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& rt) override
+    {
+        std::vector<jsi::PropNameID> out;
+        out.reserve(m_layout->property_names.size());
+        for (const auto& name : m_layout->property_names) {
+            out.emplace_back(rt, name);
+        }
+        return out;
+    }
+
+private:
+    static constexpr double max_safe_integer = 9007199254740991.0;
+
+    jsi::Value read(jsi::Runtime& rt, const ObjectHostLayout::Field& field)
+    {
+        const Mixed value = m_obj.get_any(field.column);
+        if (value.is_null())
+            return jsi::Value::null();
+        switch (field.type & ~PropertyType::Flags) {
+            case PropertyType::Int:
+                return jsi::Value(double(value.get_int()));
+            case PropertyType::Bool:
+                return jsi::Value(value.get_bool());
+            case PropertyType::Float:
+                return jsi::Value(double(value.get_float()));
+            case PropertyType::Double:
+                return jsi::Value(value.get_double());
+            case PropertyType::String: {
+                const auto str = value.get_string();
+                return jsi::String::createFromUtf8(rt, reinterpret_cast<const uint8_t*>(str.data()), str.size());
+            }
+            default:
+                // The layout only contains the types above.
+                return m_companion.getProperty(rt, field.name);
+        }
+    }
+
+    bool write(jsi::Runtime& rt, const ObjectHostLayout::Field& field, const jsi::Value& value)
+    {
+        const auto column = field.column;
+        if (value.isNull()) {
+            if (!is_nullable(field.type))
+                return false;
+            m_obj.set_null(column);
+            return true;
+        }
+        switch (field.type & ~PropertyType::Flags) {
+            case PropertyType::Int: {
+                if (!value.isNumber())
+                    return false;
+                // Anything the companion would convert differently, or reject, is left to it.
+                const double number = value.getNumber();
+                if (std::trunc(number) != number || std::abs(number) > max_safe_integer)
+                    return false;
+                m_obj.set<Int>(column, Int(number));
+                return true;
+            }
+            case PropertyType::Bool:
+                if (!value.isBool())
+                    return false;
+                m_obj.set<Bool>(column, value.getBool());
+                return true;
+            case PropertyType::Float:
+                if (!value.isNumber())
+                    return false;
+                m_obj.set<Float>(column, Float(value.getNumber()));
+                return true;
+            case PropertyType::Double:
+                if (!value.isNumber())
+                    return false;
+                m_obj.set<Double>(column, value.getNumber());
+                return true;
+            case PropertyType::String: {
+                if (!value.isString())
+                    return false;
+                const auto str = value.getString(rt).utf8(rt);
+                m_obj.set<StringData>(column, str);
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+
+    // Writing outside of a write transaction throws from the companion, with the error users expect.
+    bool is_writable()
+    {
+        if (!m_obj.is_valid())
+            return false;
+        auto group = m_obj.get_table()->get_parent_group();
+        return group && static_cast<Transaction*>(group)->get_transact_stage() == DB::transact_Writing;
+    }
+
+    const std::shared_ptr<const ObjectHostLayout> m_layout;
+    Obj m_obj;
+    jsi::Object m_companion;
+};
+
+} // namespace
+} // namespace realm::js::JSI
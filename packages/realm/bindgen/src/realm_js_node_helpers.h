@@ -47,6 +47,13 @@ REALM_NOINLINE inline Napi::Object toNodeException(Napi::Env& env, const std::ex
     catch (const Napi::Error& e) {
         return e.Value();
     }
+    catch (const std::system_error& e) {
+        // keep the error code, such that callers can tell file system errors apart
+        auto out = Napi::Error::New(env, e.what()).Value();
+        out.Set("code", e.code().value());
+        out.Set("category", e.code().category().name());
+        return out;
+    }
     catch (const std::exception& e) {
         return Napi::Error::New(env, e.what()).Value();
     }
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace realm::js {
+
+/**
+ * A bounded table of JS strings for the string values read from a Realm, such that reading a value which is already
+ * in the table returns the existing JS string, instead of decoding it and allocating a new one. This pays off for
+ * columns with few distinct values, such as statuses and categories, read over and over again.
+ * The least recently used string is evicted once the table is full. It is disabled by default, with a capacity of 0.
+ * The handles are JS values, or indexes of JS values held elsewhere, so the table must only be used from the JS thread.
+ */
+template <typename Handle>
+class StringInternTable {
+public:
+    // Longer strings are rarely repeated, and are cheaper to convert than to hash and compare.
+    static constexpr size_t max_length = 64;
+
+    bool should_intern(size_t length) const noexcept
+    {
+        return m_capacity != 0 && length <= max_length;
+    }
+
+    // Returns the handle of the string, marking it as the most recently used, or nullptr if it isn't interned.
+    const Handle* find(std::string_view str)
+    {
+        auto it = m_index.find(str);
+        if (it == m_index.end()) {
+            ++m_misses;
+            return nullptr;
+        }
+        ++m_hits;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &it->second->second;
+    }
+
+    // The handle which the next insert evicts, if the table is full, or nullptr.
+    const Handle* least_recently_used() const noexcept
+    {
+        if (m_entries.empty() || m_entries.size() < m_capacity)
+            return nullptr;
+        return &m_entries.back().second;
+    }
+
+    // Expects the string not to be interned already.
+    void insert(std::string_view str, Handle handle)
+    {
+        if (m_entries.size() >= m_capacity)
+            evict(m_capacity - 1, [](const Handle&) {});
+        m_entries.emplace_front(std::string(str), std::move(handle));
+        m_index.emplace(m_entries.front().first, m_entries.begin());
+    }
+
+    // Calls `on_evict` with the handle of every string evicted to fit the new capacity.
+    template <typename OnEvict>
+    void set_capacity(size_t capacity, OnEvict&& on_evict)
+    {
+        m_capacity = capacity;
+        evict(capacity, on_evict);
+        if (capacity == 0) {
+            m_hits = 0;
+            m_misses = 0;
+        }
+    }
+
+    void set_capacity(size_t capacity)
+    {
+        set_capacity(capacity, [](const Handle&) {});
+    }
+
+    size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+    size_t size() const noexcept
+    {
+        return m_entries.size();
+    }
+    uint64_t hits() const noexcept
+    {
+        return m_hits;
+    }
+    uint64_t misses() const noexcept
+    {
+        return m_misses;
+    }
+
+private:
+    // Using a list since it never moves its elements, which keeps the views of the keys in the index valid.
+    using Entries = std::list<std::pair<std::string, Handle>>;
+
+    template <typename OnEvict>
+    void evict(size_t size, OnEvict&& on_evict)
+    {
+        while (m_entries.size() > size) {
+            on_evict(m_entries.back().second);
+            m_index.erase(std::string_view(m_entries.back().first));
+            m_entries.pop_back();
+        }
+    }
+
+    size_t m_capacity = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+    Entries m_entries;
+    std::unordered_map<std::string_view, typename Entries::iterator> m_index;
+};
+
+} // namespace realm::js
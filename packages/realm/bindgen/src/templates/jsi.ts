@@ -59,12 +59,20 @@ class CppJsiFunc extends CppFunc {
     private addon: JsiAddon,
     name: string,
     props?: CppFuncProps,
+    // Only functions of the spec are timed, which also keeps the functions reading the stats out of them.
+    private timed = false,
   ) {
     super(name, "jsi::Value", jsi_callback_args, props);
   }
 
   definition() {
     return super.definition(`
+            ${
+              this.timed
+                ? `static auto& callStats = BindingStats::register_function("${this.name}");
+                   const BindingCallTimer callTimer(callStats);`
+                : ""
+            }
             const auto callBlock = ${this.addon.get()}->startCall();
             ${tryWrap(this.body)}
         `);
@@ -119,6 +127,30 @@ class JsiAddon extends CppClass {
         body: `return ContainerResizer(m_string_bufs);`,
       }),
     );
+
+    // See realm_js_string_intern.h.
+    this.members.push(new CppVar("StringInternTable<jsi::String>", "m_interned_strings"));
+    this.addMethod(
+      new CppMethod(
+        "toInternedString",
+        "jsi::Value",
+        [new CppVar("jsi::Runtime&", "_env"), new CppVar("StringData", "sd")],
+        {
+          body: `
+            const auto data = reinterpret_cast<const uint8_t*>(sd.data());
+            if (!m_interned_strings.should_intern(sd.size()))
+                return jsi::String::createFromUtf8(_env, data, sd.size());
+            const std::string_view key(sd.data(), sd.size());
+            if (auto interned = m_interned_strings.find(key))
+                return jsi::Value(_env, *interned);
+            auto str = jsi::String::createFromUtf8(_env, data, sd.size());
+            jsi::Value out(_env, str);
+            m_interned_strings.insert(key, std::move(str));
+            return out;
+          `,
+        },
+      ),
+    );
   }
 
   generateMembers() {
@@ -189,6 +221,11 @@ class JsiAddon extends CppClass {
     this.exports.push(name);
     return new CppJsiFunc(this, name, props);
   }
+  // Adds a function of the spec, which is timed for the binding stats.
+  addSpecFunc(name: string, props?: CppFuncProps) {
+    this.exports.push(name);
+    return new CppJsiFunc(this, name, props, true);
+  }
 
   addClass(cls: Class) {
     this.injectables.push(cls.jsName);
@@ -253,6 +290,8 @@ function convertPrimToJsi(addon: JsiAddon, type: string, expr: string): string {
       return `bigIntFromU64(_env, std::chrono::milliseconds(${expr}).count())`;
 
     case "StringData":
+      return `${addon.get()}->toInternedString(_env, ${expr})`;
+
     case "std::string_view":
     case "std::string":
       return `([&] (auto&& sd) {
@@ -798,6 +837,12 @@ class JsiCppDecls extends CppDecls {
       const casted = (expr: string) => (cls.base ? `static_cast<${derivedType}*>(${ptr(expr)})` : ptr(expr));
       const self = `(${cls.needsDeref ? "**" : "*"}${casted("args[0]")})`;
 
+      // Released wrappers pass null rather than their host object.
+      const selfCheck = (isStatic: boolean) =>
+        isStatic
+          ? ""
+          : `if (args[0].isNull()) throw jsi::JSError(_env, "${cls.jsName} has been released and can no longer be used");`;
+
       for (const method of cls.methods) {
         if (!method.isOptedInTo) continue;
 
@@ -805,10 +850,11 @@ class JsiCppDecls extends CppDecls {
         const args = method.sig.args.map((a, i) => convertFromJsi(this.addon, a.type, `args[${i + argOffset}]`));
 
         this.free_funcs.push(
-          this.addon.addFunc(method.id, {
+          this.addon.addSpecFunc(method.id, {
             body: `
               if (count != ${args.length + argOffset})
                   throw jsi::JSError(_env, "expected ${args.length} arguments");
+              ${selfCheck(method.isStatic)}
               return ${convertToJsi(this.addon, method.sig.ret, method.call({ self }, ...args))};
             `,
           }),
@@ -817,10 +863,11 @@ class JsiCppDecls extends CppDecls {
 
       if (cls.iterable) {
         this.free_funcs.push(
-          this.addon.addFunc(cls.iteratorMethodId(), {
+          this.addon.addSpecFunc(cls.iteratorMethodId(), {
             body: `
               if (count != 1)
                   throw jsi::JSError(_env, "expected 0 arguments");
+              ${selfCheck(false)}
 
               auto& self = ${self};
               auto jsIt = jsi::Object(_env);
@@ -1069,6 +1116,125 @@ class JsiCppDecls extends CppDecls {
       );
     }
 
+    // Opt-in per-function call counters and latency histograms. See realm_js_binding_stats.h.
+    {
+      this.free_funcs.push(
+        this.addon.addFunc("setBindingStatsEnabled", {
+          body: `
+            if (count != 1 || !args[0].isBool())
+                throw jsi::JSError(_env, "expected a boolean");
+            BindingStats::set_enabled(args[0].getBool());
+            return jsi::Value::undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("resetBindingStats", {
+          body: `
+            BindingStats::reset();
+            return jsi::Value::undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("getBindingStats", {
+          body: `
+            auto out = jsi::Object(_env);
+            BindingStats::for_each([&](const BindingCallStats& stats) {
+                const auto calls = stats.calls.load(std::memory_order_relaxed);
+                if (calls == 0)
+                    return;
+                auto histogram = jsi::Array(_env, BindingCallStats::num_buckets);
+                for (size_t i = 0; i < BindingCallStats::num_buckets; i++) {
+                    histogram.setValueAtIndex(_env, i, double(stats.histogram[i].load(std::memory_order_relaxed)));
+                }
+                auto entry = jsi::Object(_env);
+                entry.setProperty(_env, "calls", double(calls));
+                entry.setProperty(_env, "totalMs", double(stats.total_ns.load(std::memory_order_relaxed)) / 1e6);
+                entry.setProperty(_env, "histogram", std::move(histogram));
+                out.setProperty(_env, stats.name, std::move(entry));
+            });
+            return out;
+          `,
+        }),
+      );
+    }
+
+    // Opt-in interning of the strings read from Realms. See realm_js_string_intern.h.
+    {
+      this.free_funcs.push(
+        this.addon.addFunc("setStringInternCapacity", {
+          body: `
+            if (count != 1 || !args[0].isNumber())
+                throw jsi::JSError(_env, "expected a number");
+            const auto capacity = args[0].getNumber();
+            if (!(capacity >= 0))
+                throw jsi::JSError(_env, "expected a non-negative capacity");
+            ${this.addon.get()}->m_interned_strings.set_capacity(size_t(capacity));
+            return jsi::Value::undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("getStringInternStats", {
+          body: `
+            const auto& interned = ${this.addon.get()}->m_interned_strings;
+            auto out = jsi::Object(_env);
+            out.setProperty(_env, "capacity", double(interned.capacity()));
+            out.setProperty(_env, "size", double(interned.size()));
+            out.setProperty(_env, "hits", double(interned.hits()));
+            out.setProperty(_env, "misses", double(interned.misses()));
+            return out;
+          `,
+        }),
+      );
+    }
+
+    // Opt-in fast path for property access on Realm objects. See realm_js_jsi_object_host.h.
+    {
+      this.free_funcs.push(
+        this.addon.addFunc("createObjectHostLayout", {
+          body: `
+            if (count != 2)
+                throw jsi::JSError(_env, "expected 2 arguments");
+            auto layout = std::make_shared<ObjectHostLayout>();
+            auto names = args[0].asObject(_env).asArray(_env);
+            for (size_t i = 0, size = names.size(_env); i < size; i++) {
+                layout->property_names.push_back(
+                    jsi::PropNameID::forString(_env, names.getValueAtIndex(_env, i).asString(_env)));
+            }
+            auto fields = args[1].asObject(_env).asArray(_env);
+            for (size_t i = 0, size = fields.size(_env); i < size; i++) {
+                auto field = fields.getValueAtIndex(_env, i).asObject(_env);
+                layout->fields.push_back({
+                    jsi::PropNameID::forString(_env, field.getProperty(_env, ${this.addon.getPropId("name")}).asString(_env)),
+                    ColKey(bigIntToI64(_env, field.getProperty(_env, ${this.addon.getPropId("columnKey")}))),
+                    PropertyType(int(field.getProperty(_env, ${this.addon.getPropId("type")}).asNumber())),
+                    field.getProperty(_env, ${this.addon.getPropId("writable")}).getBool(),
+                });
+            }
+            return jsi::Object::createFromHostObject(_env, std::move(layout));
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("createObjectHost", {
+          body: `
+            if (count != 3)
+                throw jsi::JSError(_env, "expected 3 arguments");
+            auto layout = args[0].asObject(_env);
+            if (!layout.isHostObject<ObjectHostLayout>(_env))
+                throw jsi::JSError(_env, "expected an ObjectHostLayout");
+            return jsi::Object::createFromHostObject(
+                _env,
+                std::make_shared<ObjectHost>(layout.getHostObject<ObjectHostLayout>(_env), JS_TO_CLASS_Obj(_env, args[1]),
+                                             args[2].asObject(_env))
+            );
+          `,
+        }),
+      );
+    }
+
     this.addon.generateMembers();
   }
 
@@ -1092,6 +1258,9 @@ export function generate({ rawSpec, spec, file: makeFile }: TemplateContext): vo
       #include <jsi/jsi.h>
       #include <chrono>
       #include <realm_js_jsi_helpers.h>
+      #include <realm_js_binding_stats.h>
+      #include <realm_js_string_intern.h>
+      #include <realm_js_jsi_object_host.h>
 
       // Using all-caps JSI to avoid risk of conflicts with jsi namespace from fb.
       namespace realm::js::JSI {
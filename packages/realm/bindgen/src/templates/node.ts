@@ -55,6 +55,8 @@ class CppNodeFunc extends CppFunc {
     private addon: NodeAddon,
     name: string,
     props?: CppFuncProps,
+    // Only functions of the spec are timed, which also keeps the functions reading the stats out of them.
+    private timed = false,
   ) {
     super(name, "Napi::Value", [node_callback_info], props);
   }
@@ -62,6 +64,12 @@ class CppNodeFunc extends CppFunc {
   definition() {
     return super.definition(`
             ${envFromCbInfo}
+            ${
+              this.timed
+                ? `static auto& callStats = BindingStats::register_function("${this.name}");
+                   const BindingCallTimer callTimer(callStats);`
+                : ""
+            }
             const auto callBlock = ${this.addon.get()}->startCall();
             ${tryWrap(this.body)}
         `);
@@ -95,6 +103,58 @@ class NodeAddon extends CppClass {
         body: `return ContainerResizer(m_string_bufs);`,
       }),
     );
+
+    // See realm_js_string_intern.h.
+    // Node-API versions before 10 can only reference objects, so the strings are held by an array, which the table
+    // stores the indexes of. Indexes of evicted strings are reused, keeping the array no longer than the capacity.
+    this.members.push(new CppVar("StringInternTable<uint32_t>", "m_interned_strings"));
+    this.members.push(new CppVar("Napi::ObjectReference", "m_interned_string_values"));
+    this.members.push(new CppVar("std::vector<uint32_t>", "m_free_interned_slots"));
+    this.addMethod(
+      new CppMethod("toInternedString", "Napi::Value", [new CppVar("Napi::Env", env), new CppVar("StringData", "sd")], {
+        body: `
+          if (!m_interned_strings.should_intern(sd.size()))
+              return Napi::String::New(${env}, sd.data(), sd.size());
+          if (m_interned_string_values.IsEmpty())
+              m_interned_string_values = Napi::Persistent(Napi::Array::New(${env}));
+          auto values = m_interned_string_values.Value();
+          const std::string_view key(sd.data(), sd.size());
+          if (auto interned = m_interned_strings.find(key))
+              return values.Get(*interned);
+          uint32_t slot;
+          if (auto evicted = m_interned_strings.least_recently_used()) {
+              slot = *evicted;
+          }
+          else if (!m_free_interned_slots.empty()) {
+              slot = m_free_interned_slots.back();
+              m_free_interned_slots.pop_back();
+          }
+          else {
+              slot = uint32_t(m_interned_strings.size());
+          }
+          auto str = Napi::String::New(${env}, sd.data(), sd.size());
+          values.Set(slot, str);
+          m_interned_strings.insert(key, slot);
+          return str;
+        `,
+      }),
+    );
+    this.addMethod(
+      new CppMethod("setStringInternCapacity", "void", [new CppVar("size_t", "capacity")], {
+        body: `
+          if (capacity == 0) {
+              m_interned_strings.set_capacity(0);
+              m_interned_string_values.Reset();
+              m_free_interned_slots.clear();
+              return;
+          }
+          m_interned_strings.set_capacity(capacity, [&](uint32_t slot) {
+              m_interned_string_values.Value().Set(slot, m_interned_string_values.Env().Undefined());
+              m_free_interned_slots.push_back(slot);
+          });
+        `,
+      }),
+    );
   }
 
   generateMembers() {
@@ -104,20 +164,65 @@ class NodeAddon extends CppClass {
     this.classes.forEach((t) =>
       this.members.push(new CppVar("Napi::FunctionReference", NodeAddon.memberNameForExtractor(t))),
     );
+    // Classes are only defined by the wrapper when first used, so their constructors are looked up on first use too.
+    this.members.push(new CppVar("Napi::ObjectReference", "m_injectables"));
+    for (const cls of this.classes) {
+      this.addMethod(
+        new CppMethod(NodeAddon.accessorNameFor(cls), "Napi::FunctionReference&", [], {
+          attributes: "inline",
+          body: `
+            if (${NodeAddon.memberNameFor(cls)}.IsEmpty())
+                ${NodeAddon.memberNameFor(cls)} = Napi::Persistent(m_injectables.Value().Get("${cls}").As<Napi::Function>());
+            return ${NodeAddon.memberNameFor(cls)};
+          `,
+        }),
+      );
+      this.addMethod(
+        new CppMethod(NodeAddon.accessorNameForExtractor(cls), "Napi::FunctionReference&", [], {
+          attributes: "inline",
+          body: `
+            if (${NodeAddon.memberNameForExtractor(cls)}.IsEmpty())
+                ${NodeAddon.memberNameForExtractor(cls)} =
+                    Napi::Persistent(${NodeAddon.accessorNameFor(cls)}().Value().Get("_extract").As<Napi::Function>());
+            return ${NodeAddon.memberNameForExtractor(cls)};
+          `,
+        }),
+      );
+    }
     this.addMethod(
       new CppMethod("injectInjectables", "void", [node_callback_info], {
         body: `
           auto ctors = info[0].As<Napi::Object>();
           ${this.injectables
+            .filter((t) => !this.classes.includes(t))
             .map((t) => `${NodeAddon.memberNameFor(t)} = Napi::Persistent(ctors.Get("${t}").As<Napi::Function>());`)
             .join("\n")}
-          ${this.classes
-            .map(
-              (cls) =>
-                `${NodeAddon.memberNameForExtractor(cls)} =
-                  Napi::Persistent(${NodeAddon.memberNameFor(cls)}.Value().Get("_extract").As<Napi::Function>());`,
-            )
-            .join("\n")}
+          m_injectables = Napi::Persistent(ctors);
+        `,
+      }),
+    );
+
+    // Creating a JS function for every export up front is a large part of loading the addon,
+    // so functions are created when they are first looked up instead, from a table sorted by name.
+    this.addMethod(
+      new CppMethod("getFunction", "Napi::Value", [node_callback_info], {
+        body: `
+          using Factory = Napi::Function (*)(Napi::Env);
+          static constexpr std::pair<std::string_view, Factory> functions[] = {
+              ${Object.keys(this.exports)
+                .sort()
+                .map((name) => `{"${name}", [](Napi::Env ${env}) { return ${this.exports[name]}; }},`)
+                .join("\n")}
+          };
+          auto ${env} = info.Env();
+          if (info.Length() != 1 || !info[0].IsString())
+              throw Napi::TypeError::New(${env}, "expected a function name");
+          const auto name = info[0].As<Napi::String>().Utf8Value();
+          const auto it = std::lower_bound(std::begin(functions), std::end(functions), std::string_view(name),
+                                           [](const auto& entry, std::string_view name) { return entry.first < name; });
+          if (it == std::end(functions) || it->first != name)
+              return ${env}.Undefined();
+          return it->second(${env});
         `,
       }),
     );
@@ -126,9 +231,7 @@ class NodeAddon extends CppClass {
       new CppCtor(this.name, [new CppVar("Napi::Env", env), new CppVar("Napi::Object", "exports")], {
         body: `
             DefineAddon(exports, {
-                ${Object.entries(this.exports)
-                  .map(([name, val]) => `InstanceValue("${name}", ${val}, napi_enumerable),`)
-                  .join("\n")}
+                InstanceMethod<&${this.name}::getFunction>("getFunction"),
                 InstanceMethod<&${this.name}::injectInjectables>("injectInjectables"),
             });
             `,
@@ -140,6 +243,11 @@ class NodeAddon extends CppClass {
     this.exports[name] = `Napi::Function::New<${name}>(${env}, "${name}")`;
     return new CppNodeFunc(this, name, props);
   }
+  // Adds a function of the spec, which is timed for the binding stats.
+  addSpecFunc(name: string, props?: CppFuncProps) {
+    this.exports[name] = `Napi::Function::New<${name}>(${env}, "${name}")`;
+    return new CppNodeFunc(this, name, props, true);
+  }
 
   addClass(cls: Class) {
     this.injectables.push(cls.jsName);
@@ -154,13 +262,26 @@ class NodeAddon extends CppClass {
     if (typeof cls != "string") cls = cls.jsName;
     return `m_cls_${cls}_ctor`;
   }
+  static accessorNameForExtractor(cls: string) {
+    return `cls_${cls}_extractor`;
+  }
+  static accessorNameFor(cls: string) {
+    return `cls_${cls}_ctor`;
+  }
+
+  /** The member holding the constructor, or the call of the method looking it up for classes. */
+  ctorMember(cls: string | { jsName: string }) {
+    if (typeof cls != "string") cls = cls.jsName;
+    return this.classes.includes(cls) ? `${NodeAddon.accessorNameFor(cls)}()` : NodeAddon.memberNameFor(cls);
+  }
 
   accessCtor(cls: string | { jsName: string }) {
-    return `${this.get()}->${NodeAddon.memberNameFor(cls)}`;
+    return `${this.get()}->${this.ctorMember(cls)}`;
   }
 
   accessExtractor(cls: string | { jsName: string }) {
-    return `${this.get()}->${NodeAddon.memberNameForExtractor(cls)}`;
+    if (typeof cls != "string") cls = cls.jsName;
+    return `${this.get()}->${NodeAddon.accessorNameForExtractor(cls)}()`;
   }
 
   get() {
@@ -195,6 +316,8 @@ function convertPrimToNode(addon: NodeAddon, type: string, expr: string): string
       return `Napi::Number::New(${env}, std::chrono::milliseconds(${expr}).count())`;
 
     case "StringData":
+      return `${addon.get()}->toInternedString(${env}, ${expr})`;
+
     case "std::string_view":
     case "std::string":
       return `([&] (auto&& sd) {
@@ -721,7 +844,8 @@ class NodeCppDecls extends CppDecls {
 
       const selfCheck = (isStatic: boolean) => {
         if (isStatic) return "";
-        let check = `if (!info[0].IsExternal()) throw Napi::TypeError::New(${env}, "need 1 external argument");`;
+        let check = `if (!info[0].IsExternal()) throw Napi::TypeError::New(${env}, info[0].IsNull()
+            ? "${cls.jsName} has been released and can no longer be used" : "need 1 external argument");`;
         if (cls.sharedPtrWrapped)
           check += ` if (!*${casted("info[0]")}) throwNullSharedPtrError(${env}, "${cls.jsName}");`;
 
@@ -735,7 +859,7 @@ class NodeCppDecls extends CppDecls {
         const args = method.sig.args.map((a, i) => convertFromNode(this.addon, a.type, `info[${i + argOffset}]`));
 
         this.free_funcs.push(
-          this.addon.addFunc(method.id, {
+          this.addon.addSpecFunc(method.id, {
             body: `
               if (info.Length() != ${args.length + argOffset})
                   throw Napi::TypeError::New(${env}, "expected ${args.length} arguments");
@@ -748,7 +872,7 @@ class NodeCppDecls extends CppDecls {
 
       if (cls.iterable) {
         this.free_funcs.push(
-          this.addon.addFunc(cls.iteratorMethodId(), {
+          this.addon.addSpecFunc(cls.iteratorMethodId(), {
             body: `
               if (info.Length() != 1)
                   throw Napi::TypeError::New(${env}, "expected 0 arguments");
@@ -887,13 +1011,13 @@ class NodeCppDecls extends CppDecls {
                 ]
                   .map(
                     ([typeName, jsName]) =>
-                      `else if (obj.InstanceOf(addon->${NodeAddon.memberNameFor(jsName)}.Value())) {
+                      `else if (obj.InstanceOf(addon->${this.addon.ctorMember(jsName)}.Value())) {
                           return ${convertFromNode(this.addon, spec.types[typeName], "val")};
                       }`,
                   )
                   .join(" ")
               }
-              else if (obj.InstanceOf(addon->m_cls_Geospatial_ctor.Value())) {
+              else if (obj.InstanceOf(addon->${this.addon.ctorMember("Geospatial")}.Value())) {
                 //This needs its own case because the constructor of Mixed for Geospatial requires a pointer
                 return &NODE_TO_CLASS_Geospatial(val);
               }
@@ -913,6 +1037,80 @@ class NodeCppDecls extends CppDecls {
       }),
     );
 
+    // Opt-in per-function call counters and latency histograms. See realm_js_binding_stats.h.
+    {
+      this.free_funcs.push(
+        this.addon.addFunc("setBindingStatsEnabled", {
+          body: `
+            if (info.Length() != 1 || !info[0].IsBoolean())
+                throw Napi::TypeError::New(${env}, "expected a boolean");
+            BindingStats::set_enabled(info[0].As<Napi::Boolean>());
+            return ${env}.Undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("resetBindingStats", {
+          body: `
+            BindingStats::reset();
+            return ${env}.Undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("getBindingStats", {
+          body: `
+            auto out = Napi::Object::New(${env});
+            BindingStats::for_each([&](const BindingCallStats& stats) {
+                const auto calls = stats.calls.load(std::memory_order_relaxed);
+                if (calls == 0)
+                    return;
+                auto histogram = Napi::Array::New(${env}, BindingCallStats::num_buckets);
+                for (size_t i = 0; i < BindingCallStats::num_buckets; i++) {
+                    histogram.Set(uint32_t(i), double(stats.histogram[i].load(std::memory_order_relaxed)));
+                }
+                auto entry = Napi::Object::New(${env});
+                entry.Set("calls", double(calls));
+                entry.Set("totalMs", double(stats.total_ns.load(std::memory_order_relaxed)) / 1e6);
+                entry.Set("histogram", histogram);
+                out.Set(stats.name, entry);
+            });
+            return out;
+          `,
+        }),
+      );
+    }
+
+    // Opt-in interning of the strings read from Realms. See realm_js_string_intern.h.
+    {
+      this.free_funcs.push(
+        this.addon.addFunc("setStringInternCapacity", {
+          body: `
+            if (info.Length() != 1 || !info[0].IsNumber())
+                throw Napi::TypeError::New(${env}, "expected a number");
+            const auto capacity = info[0].As<Napi::Number>().Int64Value();
+            if (capacity < 0)
+                throw Napi::RangeError::New(${env}, "expected a non-negative capacity");
+            ${this.addon.get()}->setStringInternCapacity(size_t(capacity));
+            return ${env}.Undefined();
+          `,
+        }),
+      );
+      this.free_funcs.push(
+        this.addon.addFunc("getStringInternStats", {
+          body: `
+            const auto& interned = ${this.addon.get()}->m_interned_strings;
+            auto out = Napi::Object::New(${env});
+            out.Set("capacity", double(interned.capacity()));
+            out.Set("size", double(interned.size()));
+            out.Set("hits", double(interned.hits()));
+            out.Set("misses", double(interned.misses()));
+            return out;
+          `,
+        }),
+      );
+    }
+
     this.addon.generateMembers();
   }
 
@@ -933,9 +1131,15 @@ export function generate({ rawSpec, spec, file: makeFile }: TemplateContext): vo
   }
 
   out(`
+      #include <algorithm>
+      #include <string_view>
+      #include <utility>
+
       #include <napi.h>
       #include <realm_helpers.h>
       #include <realm_js_node_helpers.h>
+      #include <realm_js_binding_stats.h>
+      #include <realm_js_string_intern.h>
 
       namespace realm::js::node {
       namespace {
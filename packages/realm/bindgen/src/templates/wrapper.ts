@@ -216,9 +216,9 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
 
   out.lines(
     'import { Long, ObjectId, UUID, Decimal128, EJSON } from "bson";',
-    'import { _promisify, _throwOnAccess } from "./utils";',
+    'import { _lazyProperty, _promisify, _throwOnAccess } from "./utils";',
     'import * as utils from "./utils";',
-    'import { applyPatch } from "./patch";',
+    'import { applyClassPatch, applyPatch } from "./patch";',
     "// eslint-disable-next-line @typescript-eslint/no-namespace",
     "export namespace binding {",
   );
@@ -235,6 +235,7 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
     "export import Status = utils.Status;",
     "export import ListSentinel = utils.ListSentinel;",
     "export import DictionarySentinel = utils.DictionarySentinel;",
+    "export import setWrapperTracker = utils.setWrapperTracker;",
 
     `
     // WeakRef polyfill for Hermes.
@@ -274,12 +275,74 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
 
   out.lines("// Classes", ...spec.classes.map(generateClassDeclaration.bind(undefined, spec)));
 
+  out.lines(
+    "// Call statistics",
+    `
+    /**
+     * Calls and accumulated time spent in a native function, recorded while stats are enabled.
+     * Entry \`i\` of the histogram counts calls which took between 2^i and 2^(i+1) nanoseconds.
+     */
+    export type BindingCallStats = { calls: number; totalMs: number; histogram: number[] };
+    /** Get the stats of every native function called since the stats were last reset, keyed by function name. */
+    export declare function stats(): Record<string, BindingCallStats>;
+    export declare function resetStats(): void;
+    /** Stats are disabled by default, as recording them adds a bit of overhead to every native call. */
+    export declare function setStatsEnabled(enabled: boolean): void;
+    `,
+  );
+
+  out.lines(
+    "// String interning",
+    `
+    export type StringInternStats = { capacity: number; size: number; hits: number; misses: number };
+    /**
+     * Keep up to \`capacity\` of the strings read from Realms as JS strings, to return those instead of new strings
+     * when they are read again. A capacity of 0, which is the default, disables interning and empties the table.
+     */
+    export declare function setStringInternCapacity(capacity: number): void;
+    /** The hits and misses are counted since interning was last disabled. */
+    export declare function getStringInternStats(): StringInternStats;
+    `,
+  );
+
+  out.lines(
+    "// Host objects (JSI only)",
+    `
+    /** A property of an object type which object hosts read and write directly. */
+    export type ObjectHostField = { name: string; columnKey: ColKey; type: PropertyType; writable: boolean };
+    export declare class ObjectHostLayout {
+      private brandForObjectHostLayout;
+    }
+    /** Only available in the JSI binding, undefined on Node.js. */
+    export declare const createObjectHostLayout:
+      | ((propertyNames: string[], fields: ObjectHostField[]) => ObjectHostLayout)
+      | undefined;
+    /** Only available in the JSI binding, undefined on Node.js. */
+    export declare const createObjectHost:
+      | (<T extends object>(layout: ObjectHostLayout, obj: Obj, companion: T) => T)
+      | undefined;
+    `,
+  );
+
   out("}"); // Closing bracket for the namespace
 
+  const statsFunctions = {
+    stats: "getBindingStats",
+    resetStats: "resetBindingStats",
+    setStatsEnabled: "setBindingStatsEnabled",
+  };
+
+  const hostObjectFunctions = ["createObjectHostLayout", "createObjectHost"];
+
+  const stringInternFunctions = ["setStringInternCapacity", "getStringInternStats"];
+
   out(
     `
     Object.defineProperties(binding, {
-      ${spec.classes.map((cls) => `${cls.jsName}: { get: _throwOnAccess.bind(undefined, "${cls.jsName}"), configurable: true }`)}
+      ${spec.classes.map((cls) => `${cls.jsName}: { get: _throwOnAccess.bind(undefined, "${cls.jsName}"), configurable: true }`)},
+      ${Object.keys(statsFunctions).map((name) => `${name}: { get: _throwOnAccess.bind(undefined, "${name}"), configurable: true }`)},
+      ${hostObjectFunctions.map((name) => `${name}: { get: _throwOnAccess.bind(undefined, "${name}"), configurable: true }`)},
+      ${stringInternFunctions.map((name) => `${name}: { get: _throwOnAccess.bind(undefined, "${name}"), configurable: true }`)}
     });
     `,
   );
@@ -327,11 +390,12 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
     "EJSON_parse: EJSON.parse",
     "EJSON_stringify: EJSON.stringify",
     "Symbol_for: Symbol.for",
-    ...spec.classes.map((cls) => cls.jsName),
   ];
 
   for (const cls of spec.classes) {
     const symbolName = `_${cls.rootBase().jsName}_Symbol`;
+    // Classes are defined when first used, since defining every class up front slows down loading the package.
+    const definitionLines: string[] = [];
     const bodyLines: string[] = [];
 
     if (!cls.base) {
@@ -339,7 +403,10 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
       out(`const ${symbolName} = Symbol("Realm.${cls.jsName}.external_pointer");`);
       bodyLines.push(`${cls.subclasses.length === 0 ? "private" : "protected"} declare [${symbolName}]: unknown;`);
       bodyLines.push(
-        `${cls.subclasses.length === 0 ? "private" : "protected"} constructor(ptr: unknown) { this[${symbolName}] = ptr};`,
+        `${cls.subclasses.length === 0 ? "private" : "protected"} constructor(ptr: unknown) {
+          this[${symbolName}] = ptr;
+          if (utils._wrapperTracker.track) utils._wrapperTracker.track(this);
+        };`,
       );
     }
 
@@ -349,7 +416,11 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
           throw new TypeError("Expected a ${cls.jsName}");
         const out = self[${symbolName}];
         if (!out)
-          throw new TypeError("Received an improperly constructed ${cls.jsName}");
+          throw new TypeError(
+            out === null
+              ? "${cls.jsName} has been released and can no longer be used"
+              : "Received an improperly constructed ${cls.jsName}",
+          );
         return out;
       };  
     `);
@@ -357,9 +428,9 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
     const availableMethods = cls.methods.filter((method) => method.isOptedInTo);
 
     for (const method of availableMethods) {
-      // Eagerly bind the name once from the native module to prevent object property lookups on every call
+      // Bind the name once from the native module to prevent object property lookups on every call
       const nativeFreeFunctionName = `_native_${method.id}`;
-      out(`const ${nativeFreeFunctionName} = nativeModule.${method.id};`);
+      definitionLines.push(`const ${nativeFreeFunctionName} = nativeModule.${method.id};`);
       // TODO consider pre-extracting class-typed arguments while still in JIT VM.
       const asyncSig = method.sig.asyncTransform();
       const params = (asyncSig ?? method.sig).args.map((arg) => arg.name);
@@ -376,6 +447,11 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
         const nullAllowed = !!(ret.is("Pointer") && ret.type.kind == "Const" && ret.type.type.isPrimitive("EJson"));
         call = `_promisify(${nullAllowed}, _cb => ${call})`;
       }
+      if (method.jsName === "$release") {
+        // Dropping the pointer makes any later use throw, rather than reaching the released native state.
+        bodyLines.push(`$release() { if (this[${symbolName}]) { ${call}; this[${symbolName}] = null; } }`);
+        continue;
+      }
       bodyLines.push(
         method.isStatic ? "static" : "",
         method instanceof Property ? "get" : "",
@@ -385,20 +461,51 @@ export function generate({ spec: boundSpec, rawSpec, file }: TemplateContext): v
 
     if (cls.iterable) {
       const native = `_native_${cls.iteratorMethodId()}`;
-      out(`const ${native} = nativeModule.${cls.iteratorMethodId()};`);
+      definitionLines.push(`const ${native} = nativeModule.${cls.iteratorMethodId()};`);
       bodyLines.push(`[Symbol.iterator]() { return ${native}(this[${symbolName}]); }`);
     }
 
-    out.lines(`class ${cls.jsName} ${cls.base ? `extends ${cls.base.jsName}` : ""} {`, ...bodyLines, `}`);
+    out.lines(
+      `function _define_${cls.jsName}() {`,
+      ...definitionLines,
+      `class ${cls.jsName} ${cls.base ? `extends _get_${cls.base.jsName}()` : ""} {`,
+      ...bodyLines,
+      `}`,
+      `applyClassPatch(binding, "${cls.jsName}", ${cls.jsName});`,
+      `return ${cls.jsName};`,
+      `}`,
+      `let _cls_${cls.jsName}: ReturnType<typeof _define_${cls.jsName}> | undefined;`,
+      `function _get_${cls.jsName}() {`,
+      `if (!_cls_${cls.jsName}) { _cls_${cls.jsName} = _define_${cls.jsName}(); }`,
+      `return _cls_${cls.jsName};`,
+      `}`,
+    );
   }
 
   out(`
     Object.defineProperties(binding, {
-      ${spec.classes.map((cls) => `${cls.jsName}: { value: ${cls.jsName}, writable: false, configurable: false }`)}
+      ${spec.classes.map((cls) => `${cls.jsName}: _lazyProperty(binding, "${cls.jsName}", _get_${cls.jsName})`)},
+      ${Object.entries(statsFunctions).map(
+        ([name, native]) => `${name}: { value: nativeModule.${native}, writable: false, configurable: false }`,
+      )},
+      ${hostObjectFunctions.map(
+        (name) => `${name}: { value: nativeModule.${name}, writable: false, configurable: false }`,
+      )},
+      ${stringInternFunctions.map(
+        (name) => `${name}: { value: nativeModule.${name}, writable: false, configurable: false }`,
+      )}
     });
   `);
 
-  out(`nativeModule.injectInjectables({ ${injectables} });`);
+  // The native module looks up the classes when it first needs them, which defines them.
+  out(`
+    nativeModule.injectInjectables(
+      Object.defineProperties(
+        { ${injectables} },
+        { ${spec.classes.map((cls) => `${cls.jsName}: { get: _get_${cls.jsName}, enumerable: true }`)} },
+      ),
+    );
+  `);
 
   out("applyPatch(binding); isReady = true; resolveReadyPromise(); }");
 }
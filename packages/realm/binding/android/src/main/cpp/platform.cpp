@@ -21,6 +21,11 @@
 #include <stdarg.h>
 #include <unistd.h>
 #include <cstdio>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <filesystem>
 #include <android/asset_manager.h>
@@ -44,6 +49,76 @@ static inline bool is_realm_file(const char* str)
 static AAssetManager* s_asset_manager;
 static std::string s_default_realm_directory;
 
+namespace {
+
+// Runs the background work of the binding on a few threads shared by all of it, like the libuv threadpool does on
+// Node. The threads are joined when the library is unloaded, dropping the work which hasn't started yet.
+class WorkerPool {
+public:
+    static WorkerPool& get()
+    {
+        static WorkerPool pool(std::clamp(std::thread::hardware_concurrency(), 2u, 4u));
+        return pool;
+    }
+
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_changed.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void submit(realm::util::UniqueFunction<void()> work)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_work.push_back(std::move(work));
+        }
+        m_changed.notify_one();
+    }
+
+private:
+    explicit WorkerPool(unsigned count)
+    {
+        for (unsigned i = 0; i < count; i++) {
+            m_threads.emplace_back([this] {
+                run();
+            });
+        }
+    }
+
+    void run()
+    {
+        while (true) {
+            realm::util::UniqueFunction<void()> work;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock, [this] {
+                    return m_stopping || !m_work.empty();
+                });
+                if (m_stopping)
+                    return;
+                work = std::move(m_work.front());
+                m_work.pop_front();
+            }
+            work();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::deque<realm::util::UniqueFunction<void()>> m_work;
+    bool m_stopping = false;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace
+
 namespace realm {
 
 void JsPlatformHelpers::set_default_realm_file_directory(std::string dir)
@@ -123,6 +198,54 @@ void JsPlatformHelpers::remove_file(const std::string& path)
     fs::remove(path);
 }
 
+// runs the synchronous variant on a background thread and reports its outcome to the callback
+static void run_async(util::UniqueFunction<void()> operation, JsPlatformHelpers::CompletionCallback callback)
+{
+    JsPlatformHelpers::run_in_background([operation = std::move(operation), callback = std::move(callback)]() {
+        std::exception_ptr error;
+        try {
+            operation();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
+
+void JsPlatformHelpers::remove_realm_files_from_directory_async(const std::string& directory,
+                                                                CompletionCallback callback)
+{
+    run_async(
+        [directory] {
+            remove_realm_files_from_directory(directory);
+        },
+        std::move(callback));
+}
+
+void JsPlatformHelpers::remove_file_async(const std::string& path, CompletionCallback callback)
+{
+    run_async(
+        [path] {
+            remove_file(path);
+        },
+        std::move(callback));
+}
+
+void JsPlatformHelpers::remove_directory_async(const std::string& path, CompletionCallback callback)
+{
+    run_async(
+        [path] {
+            remove_directory(path);
+        },
+        std::move(callback));
+}
+
+void JsPlatformHelpers::run_in_background(util::UniqueFunction<void()> work)
+{
+    WorkerPool::get().submit(std::move(work));
+}
+
 void JsPlatformHelpers::exclude_from_icloud_backup(const std::string&, bool)
 {
     // no-op
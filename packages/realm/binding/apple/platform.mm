@@ -22,9 +22,11 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <memory>
 #include <string>
 
 #import <Foundation/Foundation.h>
+#include <dispatch/dispatch.h>
 #include <mach/machine.h>
 #include <sys/sysctl.h>
 
@@ -163,6 +165,48 @@ void JsPlatformHelpers::remove_directory(const std::string &path)
     remove_file(path); // works for directories too
 }
 
+// runs the synchronous variant on a background queue and reports its outcome to the callback
+static void run_async(util::UniqueFunction<void()> operation, JsPlatformHelpers::CompletionCallback callback)
+{
+    JsPlatformHelpers::run_in_background([operation = std::move(operation), callback = std::move(callback)]() {
+        std::exception_ptr error;
+        try {
+            operation();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+        callback(error);
+    });
+}
+
+void JsPlatformHelpers::remove_realm_files_from_directory_async(const std::string &directory, CompletionCallback callback)
+{
+    run_async([directory] { remove_realm_files_from_directory(directory); }, std::move(callback));
+}
+
+void JsPlatformHelpers::remove_file_async(const std::string &path, CompletionCallback callback)
+{
+    run_async([path] { remove_file(path); }, std::move(callback));
+}
+
+void JsPlatformHelpers::remove_directory_async(const std::string &path, CompletionCallback callback)
+{
+    run_async([path] { remove_directory(path); }, std::move(callback));
+}
+
+void JsPlatformHelpers::run_in_background(util::UniqueFunction<void()> work)
+{
+    // blocks can't capture move-only values, so pass the work through the context pointer instead
+    auto context = new util::UniqueFunction<void()>(std::move(work));
+    dispatch_async_f(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), context, [](void *ptr) {
+        std::unique_ptr<util::UniqueFunction<void()>> work(static_cast<util::UniqueFunction<void()> *>(ptr));
+        @autoreleasepool {
+            (*work)();
+        }
+    });
+}
+
 void JsPlatformHelpers::exclude_from_icloud_backup(const std::string& path, bool value) {
     NSNumber *current;
   
@@ -0,0 +1,44 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/object-store/util/scheduler.hpp>
+
+namespace realm {
+namespace js {
+
+/*
+ * The configuration for another instance of a Realm, owned by a task on a background thread. The callbacks of the
+ * configuration are JS functions, which can't be called from the background thread, so they're cleared: the Realm
+ * is already open on the JS thread, so there is nothing to migrate, initialize or compact on launch anyway.
+ */
+inline RealmConfig background_config(const RealmConfig& config)
+{
+    RealmConfig out = config;
+    out.scheduler = util::Scheduler::make_dummy();
+    out.cache = false;
+    out.migration_function = nullptr;
+    out.initialization_function = nullptr;
+    out.should_compact_on_launch_function = nullptr;
+    return out;
+}
+
+} // namespace js
+} // namespace realm
@@ -0,0 +1,781 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "background_config.hpp"
+#include "platform.hpp"
+
+#include <realm/decimal128.hpp>
+#include <realm/obj.hpp>
+#include <realm/object_id.hpp>
+#include <realm/object-store/object_store.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/table.hpp>
+#include <realm/timestamp.hpp>
+#include <realm/util/base64.hpp>
+#include <realm/util/bson/bson.hpp>
+#include <realm/util/functional.hpp>
+#include <realm/uuid.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace realm {
+
+struct ImportResult {
+    size_t imported = 0;
+    size_t errors = 0;
+    // The first `max_error_messages` errors, prefixed with the line they occurred on.
+    std::vector<std::string> error_messages;
+};
+
+namespace js {
+namespace importer {
+
+enum class ImportFormat { ndjson, csv };
+
+inline ImportFormat parse_format(std::string_view format)
+{
+    if (format == "ndjson")
+        return ImportFormat::ndjson;
+    if (format == "csv")
+        return ImportFormat::csv;
+    throw std::invalid_argument("Unsupported import format '" + std::string(format) + "'");
+}
+
+class ImportError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct ImportColumn {
+    ColKey key;
+    // The index of the column in the values of a row.
+    size_t index;
+};
+
+// Days since 1970-01-01 of a date in the proleptic Gregorian calendar, see http://howardhinnant.github.io/date_algorithms.html
+inline int64_t days_from_civil(int64_t y, unsigned m, unsigned d)
+{
+    y -= m <= 2;
+    const int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = unsigned(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + int64_t(doe) - 719468;
+}
+
+// Parses ISO 8601 dates such as "2024-01-31", "2024-01-31T12:34:56Z" and "2024-01-31T12:34:56.789+01:00".
+inline Timestamp parse_timestamp(const std::string& text)
+{
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0, consumed = 0;
+    const char* p = text.c_str();
+    if (std::sscanf(p, "%d-%d-%d%n", &year, &month, &day, &consumed) != 3)
+        throw ImportError("Invalid date '" + text + "'");
+    p += consumed;
+    int64_t nanoseconds = 0;
+    int64_t offset_seconds = 0;
+    if (*p == 'T' || *p == ' ') {
+        if (std::sscanf(p + 1, "%d:%d:%d%n", &hour, &minute, &second, &consumed) != 3)
+            throw ImportError("Invalid date '" + text + "'");
+        p += 1 + consumed;
+        if (*p == '.') {
+            int64_t scale = 100000000;
+            for (p++; *p >= '0' && *p <= '9'; p++, scale /= 10) {
+                nanoseconds += (*p - '0') * scale;
+            }
+        }
+        if (*p == 'Z') {
+            p++;
+        }
+        else if (*p == '+' || *p == '-') {
+            int offset_hours = 0, offset_minutes = 0;
+            if (std::sscanf(p + 1, "%2d:%2d%n", &offset_hours, &offset_minutes, &consumed) != 2)
+                throw ImportError("Invalid date '" + text + "'");
+            offset_seconds = (*p == '-' ? -1 : 1) * (offset_hours * 3600 + offset_minutes * 60);
+            p += 1 + consumed;
+        }
+    }
+    if (*p != '\0' || month < 1 || month > 12 || day < 1 || day > 31)
+        throw ImportError("Invalid date '" + text + "'");
+    int64_t seconds = days_from_civil(year, unsigned(month), unsigned(day)) * 86400 + hour * 3600 + minute * 60 +
+                      second - offset_seconds;
+    // Realm requires the seconds and nanoseconds to have the same sign.
+    if (seconds < 0 && nanoseconds > 0) {
+        seconds += 1;
+        nanoseconds -= 1000000000;
+    }
+    return Timestamp(seconds, int32_t(nanoseconds));
+}
+
+/*
+ * The values of a batch of rows. Strings and binaries are owned by the batch, as Mixed only references them.
+ */
+struct ParsedBatch {
+    struct Row {
+        size_t line;
+        // A value per column, or none to leave the column at its default value.
+        std::vector<std::optional<Mixed>> values;
+    };
+    std::vector<Row> rows;
+    std::vector<std::pair<size_t, std::string>> errors;
+    std::deque<std::string> strings;
+};
+
+struct Record {
+    size_t line;
+    std::string text;
+};
+
+/*
+ * Converts the values in a file to the types of the columns they're imported into.
+ * Text is accepted for any type, in the format written by Results#exportTo, which writes the values of mixed
+ * properties as Extended JSON to keep their types.
+ */
+class ValueConverter {
+public:
+    ValueConverter(ParsedBatch& batch)
+        : m_batch(batch)
+    {
+    }
+
+    // Empty fields are null unless quoted, and fields of mixed properties are read as Extended JSON if they parse.
+    Mixed from_csv_field(ColKey key, std::string_view text, bool quoted)
+    {
+        if (text.empty() && !quoted)
+            return null_for(key);
+        if (key.get_type() == col_type_Mixed) {
+            std::optional<bson::Bson> value;
+            try {
+                value = bson::parse(text);
+            }
+            catch (const std::exception&) {
+                // Plain text, such as from a file which wasn't exported by Results#exportTo
+            }
+            if (value)
+                return from_bson(key, *value);
+        }
+        return from_text(key, text);
+    }
+
+    Mixed from_text(ColKey key, std::string_view text)
+    {
+        std::string value(text);
+        switch (key.get_type()) {
+            case col_type_Int: {
+                errno = 0;
+                char* end = nullptr;
+                const auto number = std::strtoll(value.c_str(), &end, 10);
+                if (value.empty() || *end != '\0' || errno == ERANGE)
+                    throw ImportError("Invalid integer '" + value + "'");
+                return Mixed(int64_t(number));
+            }
+            case col_type_Bool:
+                if (value == "true")
+                    return Mixed(true);
+                if (value == "false")
+                    return Mixed(false);
+                throw ImportError("Invalid boolean '" + value + "'");
+            case col_type_Float:
+                return Mixed(float(parse_double(value)));
+            case col_type_Double:
+                return Mixed(parse_double(value));
+            case col_type_Timestamp:
+                return Mixed(parse_timestamp(value));
+            case col_type_ObjectId:
+                if (!ObjectId::is_valid_str(value))
+                    throw ImportError("Invalid object id '" + value + "'");
+                return Mixed(ObjectId(value.c_str()));
+            case col_type_UUID:
+                return Mixed(parse_uuid(value));
+            case col_type_Decimal: {
+                Decimal128 decimal(value);
+                if (decimal.is_nan() && value != "NaN")
+                    throw ImportError("Invalid decimal '" + value + "'");
+                return Mixed(decimal);
+            }
+            case col_type_Binary: {
+                auto decoded = util::base64_decode_to_vector(value);
+                if (!decoded)
+                    throw ImportError("Invalid Base64 '" + value + "'");
+                const auto& stored = m_batch.strings.emplace_back(decoded->begin(), decoded->end());
+                return Mixed(BinaryData(stored.data(), stored.size()));
+            }
+            case col_type_String:
+            case col_type_Mixed: {
+                const auto& stored = m_batch.strings.emplace_back(std::move(value));
+                return Mixed(StringData(stored));
+            }
+            default:
+                throw ImportError("Unsupported property type");
+        }
+    }
+
+    Mixed from_bson(ColKey key, const bson::Bson& value)
+    {
+        using Type = bson::Bson::Type;
+        const auto type = key.get_type();
+        switch (value.type()) {
+            case Type::Null:
+                return null_for(key);
+            case Type::String:
+                return from_text(key, static_cast<const std::string&>(value));
+            case Type::Int32:
+            case Type::Int64:
+            case Type::Double: {
+                const double number = value.type() == Type::Double ? static_cast<double>(value)
+                                      : value.type() == Type::Int32 ? static_cast<int32_t>(value)
+                                                                     : double(static_cast<int64_t>(value));
+                if (type == col_type_Int || (type == col_type_Mixed && value.type() != Type::Double)) {
+                    if (value.type() == Type::Int64)
+                        return Mixed(static_cast<int64_t>(value));
+                    if (value.type() == Type::Int32)
+                        return Mixed(int64_t(static_cast<int32_t>(value)));
+                    if (number != double(int64_t(number)))
+                        throw ImportError("Expected an integer, got " + value.to_string());
+                    return Mixed(int64_t(number));
+                }
+                if (type == col_type_Double || type == col_type_Mixed)
+                    return Mixed(number);
+                if (type == col_type_Float)
+                    return Mixed(float(number));
+                if (type == col_type_Decimal)
+                    return Mixed(Decimal128(number));
+                break;
+            }
+            case Type::Bool:
+                if (type == col_type_Bool || type == col_type_Mixed)
+                    return Mixed(static_cast<bool>(value));
+                break;
+            case Type::Datetime:
+                if (type == col_type_Timestamp || type == col_type_Mixed)
+                    return Mixed(static_cast<Timestamp>(value));
+                break;
+            case Type::ObjectId:
+                if (type == col_type_ObjectId || type == col_type_Mixed)
+                    return Mixed(static_cast<ObjectId>(value));
+                break;
+            case Type::Uuid:
+                if (type == col_type_UUID || type == col_type_Mixed)
+                    return Mixed(static_cast<UUID>(value));
+                break;
+            case Type::Decimal128:
+                if (type == col_type_Decimal || type == col_type_Mixed)
+                    return Mixed(static_cast<Decimal128>(value));
+                break;
+            case Type::Binary:
+                if (type == col_type_Binary || type == col_type_Mixed) {
+                    const auto& binary = static_cast<const std::vector<char>&>(value);
+                    const auto& stored = m_batch.strings.emplace_back(binary.begin(), binary.end());
+                    return Mixed(BinaryData(stored.data(), stored.size()));
+                }
+                break;
+            case Type::Document:
+                // A UUID in Extended JSON, unless the parser already read it as one.
+                if (type == col_type_UUID || type == col_type_Mixed) {
+                    for (const auto& [name, uuid] : static_cast<const bson::BsonDocument&>(value)) {
+                        if (name == "$uuid" && uuid.type() == Type::String)
+                            return Mixed(parse_uuid(static_cast<const std::string&>(uuid)));
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+        throw ImportError("Unexpected value " + value.to_string());
+    }
+
+private:
+    static UUID parse_uuid(const std::string& value)
+    {
+        if (!UUID::is_valid_string(value))
+            throw ImportError("Invalid UUID '" + value + "'");
+        return UUID(value);
+    }
+
+    static double parse_double(const std::string& value)
+    {
+        char* end = nullptr;
+        const double number = std::strtod(value.c_str(), &end);
+        if (value.empty() || *end != '\0')
+            throw ImportError("Invalid number '" + value + "'");
+        return number;
+    }
+
+    static Mixed null_for(ColKey key)
+    {
+        if (!key.is_nullable())
+            throw ImportError("Null is not allowed for a required property");
+        return Mixed();
+    }
+
+    ParsedBatch& m_batch;
+};
+
+/*
+ * Reads records from the file: lines for NDJSON and lines with balanced quotes for CSV,
+ * as a quoted CSV field may span multiple lines.
+ */
+class RecordReader {
+public:
+    RecordReader(const std::string& path, ImportFormat format)
+        : m_file(std::fopen(path.c_str(), "rb"))
+        , m_format(format)
+    {
+        if (!m_file)
+            throw std::runtime_error("Failed to open '" + path + "' for reading");
+    }
+
+    ~RecordReader()
+    {
+        std::fclose(m_file);
+    }
+
+    RecordReader(const RecordReader&) = delete;
+    RecordReader& operator=(const RecordReader&) = delete;
+
+    // Returns false at the end of the file. Blank lines are skipped.
+    bool next(std::string& record)
+    {
+        record.clear();
+        bool in_quotes = false;
+        while (true) {
+            const int c = get();
+            if (c == EOF)
+                return !record.empty();
+            if (c == '\n')
+                m_line++;
+            if (c == '"' && m_format == ImportFormat::csv)
+                in_quotes = !in_quotes;
+            if (c == '\n' && !in_quotes) {
+                if (!record.empty() && record.back() == '\r')
+                    record.pop_back();
+                if (!record.empty())
+                    return true;
+                continue;
+            }
+            if (record.empty())
+                m_record_line = m_line + 1;
+            record += char(c);
+        }
+    }
+
+    // The line number the last record started on.
+    size_t line() const
+    {
+        return m_record_line;
+    }
+
+private:
+    static constexpr size_t buffer_size = 1 << 16;
+
+    int get()
+    {
+        if (m_position == m_end) {
+            m_end = std::fread(m_buffer.data(), 1, m_buffer.size(), m_file);
+            m_position = 0;
+            if (m_end == 0) {
+                if (std::ferror(m_file))
+                    throw std::runtime_error("Failed to read the import file");
+                return EOF;
+            }
+        }
+        return static_cast<unsigned char>(m_buffer[m_position++]);
+    }
+
+    std::FILE* m_file;
+    const ImportFormat m_format;
+    std::vector<char> m_buffer = std::vector<char>(buffer_size);
+    size_t m_position = 0;
+    size_t m_end = 0;
+    size_t m_line = 0;
+    size_t m_record_line = 0;
+};
+
+inline std::vector<std::string> split_csv_record(const std::string& record, std::vector<bool>* quoted = nullptr)
+{
+    std::vector<std::string> fields(1);
+    if (quoted)
+        quoted->assign(1, false);
+    bool in_quotes = false;
+    for (size_t i = 0; i < record.size(); i++) {
+        const char c = record[i];
+        if (in_quotes) {
+            if (c == '"' && i + 1 < record.size() && record[i + 1] == '"') {
+                fields.back() += '"';
+                i++;
+            }
+            else if (c == '"') {
+                in_quotes = false;
+            }
+            else {
+                fields.back() += c;
+            }
+        }
+        else if (c == '"') {
+            in_quotes = true;
+            if (quoted)
+                quoted->back() = true;
+        }
+        else if (c == ',') {
+            fields.emplace_back();
+            if (quoted)
+                quoted->push_back(false);
+        }
+        else {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+/*
+ * Parses the records of a batch into values. Called from worker threads: it only reads the immutable mapping from
+ * fields to columns and writes to the batch it is given.
+ */
+class RecordParser {
+public:
+    RecordParser(ImportFormat format, std::unordered_map<std::string, ImportColumn> columns)
+        : m_format(format)
+        , m_columns(std::move(columns))
+    {
+    }
+
+    // Maps the fields of the CSV header to columns, ignoring unknown fields.
+    void set_csv_header(const std::string& record)
+    {
+        for (const auto& field : split_csv_record(record)) {
+            const auto it = m_columns.find(field);
+            m_csv_columns.push_back(it == m_columns.end() ? nullptr : &it->second);
+        }
+    }
+
+    void parse(ParsedBatch& batch, const std::vector<Record>& records) const
+    {
+        ValueConverter converter(batch);
+        for (const auto& record : records) {
+            try {
+                ParsedBatch::Row row{record.line, std::vector<std::optional<Mixed>>(m_columns.size())};
+                auto set = [&](const ImportColumn& column, Mixed value) {
+                    row.values[column.index] = value;
+                };
+                if (m_format == ImportFormat::csv) {
+                    std::vector<bool> quoted;
+                    const auto fields = split_csv_record(record.text, &quoted);
+                    if (fields.size() != m_csv_columns.size())
+                        throw ImportError("Expected " + std::to_string(m_csv_columns.size()) + " fields, got " +
+                                          std::to_string(fields.size()));
+                    for (size_t i = 0; i < fields.size(); i++) {
+                        if (m_csv_columns[i])
+                            set(*m_csv_columns[i],
+                                converter.from_csv_field(m_csv_columns[i]->key, fields[i], quoted[i]));
+                    }
+                }
+                else {
+                    const auto document = bson::parse(record.text);
+                    if (document.type() != bson::Bson::Type::Document)
+                        throw ImportError("Expected an object");
+                    for (const auto& [name, value] : static_cast<const bson::BsonDocument&>(document)) {
+                        const auto it = m_columns.find(name);
+                        if (it != m_columns.end())
+                            set(it->second, converter.from_bson(it->second.key, value));
+                    }
+                }
+                batch.rows.push_back(std::move(row));
+            }
+            catch (const std::exception& e) {
+                batch.errors.emplace_back(record.line, e.what());
+            }
+        }
+    }
+
+private:
+    const ImportFormat m_format;
+    const std::unordered_map<std::string, ImportColumn> m_columns;
+    std::vector<const ImportColumn*> m_csv_columns;
+};
+
+/*
+ * A fixed set of threads parsing batches for the writer, started once per import rather than once per batch.
+ * Batches still queued when the workers are destroyed are dropped, but the ones being parsed are finished first.
+ */
+class ParseWorkers {
+public:
+    explicit ParseWorkers(size_t count)
+    {
+        for (size_t i = 0; i < count; i++) {
+            m_threads.emplace_back([this] {
+                work();
+            });
+        }
+    }
+
+    ~ParseWorkers()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_changed.notify_all();
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    std::future<ParsedBatch> submit(util::UniqueFunction<ParsedBatch()> parse)
+    {
+        std::packaged_task<ParsedBatch()> task(std::move(parse));
+        auto result = task.get_future();
+        {
+            std::lock_guard lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_changed.notify_one();
+        return result;
+    }
+
+private:
+    void work()
+    {
+        while (true) {
+            std::packaged_task<ParsedBatch()> task;
+            {
+                std::unique_lock lock(m_mutex);
+                m_changed.wait(lock, [this] {
+                    return m_stopping || !m_tasks.empty();
+                });
+                if (m_stopping)
+                    return;
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::deque<std::packaged_task<ParsedBatch()>> m_tasks;
+    bool m_stopping = false;
+    std::vector<std::thread> m_threads;
+};
+
+} // namespace importer
+} // namespace js
+
+class JsBulkImporter {
+public:
+    using ProgressCallback = util::UniqueFunction<void(size_t)>;
+    using CompletionCallback = util::UniqueFunction<void(ImportResult, std::exception_ptr)>;
+
+    static constexpr size_t max_error_messages = 100;
+
+    /**
+     * Creates objects of `object_type` from the records of a file in the background, committing a write
+     * transaction per `batch_size` records. Records are parsed by a pool of threads, while a single thread writes.
+     * Records which fail to parse or write are counted as errors rather than failing the import.
+     * `on_progress`, if any, is called with the number of records processed after every batch and `on_complete` once
+     * done. As for exports, `on_progress` is an off-thread callback, which the binding dispatches to the JS thread.
+     */
+    static void import_from(const SharedRealm& realm, const std::string& path, const std::string& object_type,
+                            const std::string& format, const std::vector<std::string>& field_names,
+                            const std::vector<std::string>& column_names, bool upsert, size_t batch_size,
+                            ProgressCallback on_progress, CompletionCallback on_complete)
+    {
+        using namespace js::importer;
+        const auto import_format = parse_format(format);
+        auto table = ObjectStore::table_for_object_type(realm->read_group(), object_type);
+        if (!table)
+            throw std::invalid_argument("Unknown object type '" + object_type + "'");
+        if (table->is_embedded())
+            throw std::invalid_argument("Embedded objects can't be imported");
+
+        std::unordered_map<std::string, ImportColumn> columns;
+        std::vector<ColKey> keys;
+        for (size_t i = 0; i < column_names.size(); i++) {
+            const auto key = table->get_column_key(column_names[i]);
+            if (!key)
+                throw std::invalid_argument("Unknown property '" + column_names[i] + "'");
+            if (key.is_collection() || key.get_type() == col_type_Link)
+                throw std::invalid_argument("Property '" + field_names[i] +
+                                            "' can't be imported, only properties of primitive types can");
+            columns.emplace(field_names[i], ImportColumn{key, keys.size()});
+            keys.push_back(key);
+        }
+
+        // The objects are written by another instance of the Realm, owned by the background task.
+        JsPlatformHelpers::run_in_background([config = js::background_config(realm->config()),
+                                              table_key = table->get_key(), path, import_format,
+                                              columns = std::move(columns), keys = std::move(keys), upsert,
+                                              batch_size = std::max<size_t>(batch_size, 1),
+                                              on_progress = std::move(on_progress),
+                                              on_complete = std::move(on_complete)]() mutable {
+            ImportResult result;
+            try {
+                auto writer = Realm::get_shared_realm(std::move(config));
+                RecordParser parser(import_format, std::move(columns));
+                run(*writer, table_key, path, import_format, parser, keys, upsert, batch_size, on_progress, result);
+                writer->close();
+            }
+            catch (...) {
+                on_complete(std::move(result), std::current_exception());
+                return;
+            }
+            on_complete(std::move(result), nullptr);
+        });
+    }
+
+private:
+    static void add_error(ImportResult& result, size_t line, const std::string& message)
+    {
+        result.errors++;
+        if (result.error_messages.size() < max_error_messages)
+            result.error_messages.push_back("Line " + std::to_string(line) + ": " + message);
+    }
+
+    static void run(Realm& writer, TableKey table_key, const std::string& path, js::importer::ImportFormat format,
+                    js::importer::RecordParser& parser, const std::vector<ColKey>& keys, bool upsert,
+                    size_t batch_size, ProgressCallback& on_progress, ImportResult& result)
+    {
+        using namespace js::importer;
+        RecordReader reader(path, format);
+        if (format == ImportFormat::csv) {
+            std::string header;
+            if (!reader.next(header))
+                return;
+            parser.set_csv_header(header);
+        }
+
+        auto read_batch = [&] {
+            std::vector<Record> records;
+            std::string text;
+            while (records.size() < batch_size && reader.next(text)) {
+                records.push_back({reader.line(), std::move(text)});
+            }
+            return records;
+        };
+
+        // Keeps at most a batch per thread parsing ahead of the writer, which bounds the memory used.
+        const size_t parallelism = std::max(1u, std::thread::hardware_concurrency());
+        ParseWorkers workers(parallelism);
+        std::deque<std::future<ParsedBatch>> pending;
+        size_t processed = 0;
+        while (true) {
+            while (pending.size() < parallelism) {
+                auto records = read_batch();
+                if (records.empty())
+                    break;
+                pending.push_back(workers.submit([&parser, records = std::move(records)] {
+                    ParsedBatch batch;
+                    parser.parse(batch, records);
+                    return batch;
+                }));
+            }
+            if (pending.empty())
+                break;
+            auto batch = pending.front().get();
+            pending.pop_front();
+            write_batch(writer, table_key, batch, keys, upsert, result);
+            processed += batch.rows.size() + batch.errors.size();
+            if (on_progress)
+                on_progress(processed);
+        }
+    }
+
+    static void check_sizes(const js::importer::ParsedBatch::Row& row)
+    {
+        using js::importer::ImportError;
+        for (const auto& value : row.values) {
+            if (!value || value->is_null())
+                continue;
+            if (value->is_type(type_String) && value->get_string().size() > Table::max_string_size)
+                throw ImportError("String of " + std::to_string(value->get_string().size()) + " bytes is too long");
+            if (value->is_type(type_Binary) && value->get_binary().size() > Table::max_binary_size)
+                throw ImportError("Binary of " + std::to_string(value->get_binary().size()) + " bytes is too long");
+        }
+    }
+
+    static void write_batch(Realm& writer, TableKey table_key, const js::importer::ParsedBatch& batch,
+                            const std::vector<ColKey>& keys, bool upsert, ImportResult& result)
+    {
+        using namespace js::importer;
+        for (const auto& [line, message] : batch.errors) {
+            add_error(result, line, message);
+        }
+
+        writer.begin_transaction();
+        auto table = writer.read_group().get_table(table_key);
+        const auto primary_key = table->get_primary_key_column();
+        const auto primary_key_index =
+            primary_key ? size_t(std::find(keys.begin(), keys.end(), primary_key) - keys.begin()) : keys.size();
+        for (const auto& row : batch.rows) {
+            Obj obj;
+            bool did_create = true;
+            try {
+                // Checked before anything is written, such that a row which fails leaves an upserted object as it was.
+                check_sizes(row);
+                if (primary_key) {
+                    if (primary_key_index == keys.size() || !row.values[primary_key_index])
+                        throw ImportError("Missing primary key");
+                    const auto& value = *row.values[primary_key_index];
+                    obj = table->create_object_with_primary_key(value, &did_create);
+                    if (!did_create && !upsert) {
+                        std::ostringstream message;
+                        message << "An object with primary key " << value << " already exists";
+                        throw ImportError(message.str());
+                    }
+                }
+                else {
+                    obj = table->create_object();
+                }
+                for (size_t i = 0; i < keys.size(); i++) {
+                    if (i != primary_key_index && row.values[i])
+                        obj.set_any(keys[i], *row.values[i]);
+                }
+                result.imported++;
+            }
+            catch (const std::exception& e) {
+                // The types of the values were validated while parsing and their sizes above, so this is only
+                // expected for duplicate primary keys, which are found before any value is set.
+                if (obj.is_valid() && did_create)
+                    obj.remove();
+                add_error(result, row.line, e.what());
+            }
+        }
+        writer.commit_transaction();
+    }
+};
+
+} // namespace realm
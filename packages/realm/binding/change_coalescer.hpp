@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/object-store/impl/collection_change_builder.hpp>
+#include <realm/object-store/results.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace realm {
+
+class ChangeCoalescer;
+using SharedChangeCoalescer = std::shared_ptr<ChangeCoalescer>;
+
+/**
+ * Merges the change sets of consecutive notifications of a collection, such that a listener which is called less
+ * often than the collection changes gets the combined changes since it was last called, without every change set
+ * being converted to JS.
+ */
+class ChangeCoalescer : public std::enable_shared_from_this<ChangeCoalescer> {
+public:
+    static SharedChangeCoalescer make()
+    {
+        return std::make_shared<ChangeCoalescer>();
+    }
+
+    // `on_pending` is called when a change set arrives and nothing is pending, i.e. once per call to `take`.
+    NotificationToken add_notification_callback(Results& results, std::optional<KeyPathArray> key_paths,
+                                                std::function<void()> on_pending)
+    {
+        return results.add_notification_callback(
+            [weak_self = weak_from_this(), on_pending = std::move(on_pending)](const CollectionChangeSet& changes) {
+                auto self = weak_self.lock();
+                if (!self)
+                    return;
+                const bool was_pending = self->m_pending;
+                self->merge(changes);
+                if (!was_pending)
+                    on_pending();
+            },
+            std::move(key_paths));
+    }
+
+    // Returns the changes merged since the last call and starts over.
+    CollectionChangeSet take()
+    {
+        CollectionChangeSet changes = std::move(m_changes).finalize();
+        m_changes = {};
+        m_pending = false;
+        return changes;
+    }
+
+    // The number of milliseconds since the last change set arrived.
+    double idle_ms() const
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_last_change).count();
+    }
+
+private:
+    void merge(const CollectionChangeSet& changes)
+    {
+        // Builders keep modifications in the index space of the new version, like `modifications_new`.
+        _impl::CollectionChangeBuilder builder(changes.deletions, changes.insertions, changes.modifications_new,
+                                               changes.moves, changes.collection_root_was_deleted,
+                                               changes.collection_was_cleared);
+        if (m_pending) {
+            m_changes.merge(std::move(builder));
+        }
+        else {
+            m_changes = std::move(builder);
+        }
+        m_pending = true;
+        m_last_change = std::chrono::steady_clock::now();
+    }
+
+    _impl::CollectionChangeBuilder m_changes;
+    bool m_pending = false;
+    std::chrono::steady_clock::time_point m_last_change = std::chrono::steady_clock::now();
+};
+
+} // namespace realm
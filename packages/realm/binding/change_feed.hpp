@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/db.hpp>
+#include <realm/exceptions.hpp>
+#include <realm/object-store/impl/transact_log_handler.hpp>
+#include <realm/object-store/object_schema.hpp>
+#include <realm/object-store/object_store.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/table.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace realm {
+
+struct TableChanges {
+    std::string object_type;
+    std::vector<std::string> insertions;
+    std::vector<std::string> deletions;
+    std::vector<std::string> modifications;
+    // The public names of the properties changed on each of the modified objects, in the same order.
+    std::vector<std::vector<std::string>> modified_properties;
+};
+
+struct ChangeFeed {
+    // The version the changes lead up to, to pass back in to get the changes made after it.
+    size_t version = 0;
+    size_t index = 0;
+    // Set when the changes since the requested version are unknown, because it is no longer in the file.
+    bool reset = false;
+    std::vector<TableChanges> tables;
+};
+
+class JsChangeFeed {
+public:
+    /**
+     * Computes the objects inserted, modified and deleted between a previous version of the Realm and the version
+     * the Realm is currently at, by replaying the transaction logs in between.
+     * Only versions still held by a reader of the file can be replayed from, as local Realms don't keep the
+     * history of older versions. For any other version, including any version from before the file was last
+     * opened, the result is flagged as a reset, and the caller should start over from the version returned.
+     */
+    static ChangeFeed changes_since(const SharedRealm& realm, size_t version, size_t index)
+    {
+        auto& transaction = static_cast<Transaction&>(realm->read_group());
+        const VersionID current = transaction.get_version_of_current_transaction();
+
+        ChangeFeed out;
+        out.version = size_t(current.version);
+        out.index = size_t(current.index);
+        // Versions start at 1, so 0 stands for having no version to start from.
+        if (version == 0) {
+            out.reset = true;
+            return out;
+        }
+        const VersionID since(version, uint_fast32_t(index));
+        if (since == current)
+            return out;
+        // A version from the future can only be a token of another file.
+        if (since.version > current.version) {
+            out.reset = true;
+            return out;
+        }
+
+        TransactionRef replay;
+        try {
+            replay = transaction.get_db()->start_read(since);
+        }
+        catch (const Exception& e) {
+            if (e.code() != ErrorCodes::BadVersion)
+                throw;
+            out.reset = true;
+            return out;
+        }
+
+        _impl::TransactionChangeInfo info;
+        info.track_all = true;
+        _impl::transaction::advance(*replay, info, current);
+
+        for (auto& [table_key, changes] : info.tables) {
+            if (changes.empty() || !replay->has_table(table_key))
+                continue;
+            auto table = replay->get_table(table_key);
+            auto object_type = ObjectStore::object_type_for_table_name(table->get_name());
+            // Skip the internal tables, such as the metadata tables.
+            if (object_type.size() == 0)
+                continue;
+            out.tables.push_back(to_table_changes(*realm, std::string(object_type), changes));
+        }
+        std::sort(out.tables.begin(), out.tables.end(), [](const TableChanges& a, const TableChanges& b) {
+            return a.object_type < b.object_type;
+        });
+        return out;
+    }
+
+    /**
+     * Holds on to the version the Realm is currently at, until the Realm returned is closed, such that changes can
+     * be replayed from it. This also keeps the file from shrinking below that version.
+     */
+    static SharedRealm pin(const SharedRealm& realm)
+    {
+        return realm->freeze();
+    }
+
+private:
+    static TableChanges to_table_changes(Realm& realm, std::string object_type, const ObjectChangeSet& changes)
+    {
+        std::unordered_map<int64_t, std::string> property_names;
+        auto object_schema = realm.schema().find(object_type);
+        if (object_schema != realm.schema().end()) {
+            for (auto& property : object_schema->persisted_properties)
+                property_names.emplace(property.column_key.value, property.public_name.empty() ? property.name
+                                                                                               : property.public_name);
+        }
+
+        TableChanges out;
+        out.object_type = std::move(object_type);
+        const auto& insertions = changes.get_insertions();
+        out.insertions = sorted_keys(insertions);
+        out.deletions = sorted_keys(changes.get_deletions());
+
+        std::vector<int64_t> modified;
+        modified.reserve(changes.get_modifications().size());
+        for (auto& [key, columns] : changes.get_modifications()) {
+            // Objects inserted since the version are reported as insertions only.
+            if (insertions.count(key) == 0)
+                modified.push_back(key);
+        }
+        std::sort(modified.begin(), modified.end());
+        out.modifications.reserve(modified.size());
+        out.modified_properties.reserve(modified.size());
+        for (int64_t key : modified) {
+            out.modifications.push_back(std::to_string(key));
+            auto& names = out.modified_properties.emplace_back();
+            for (int64_t column : changes.get_modifications().at(key)) {
+                // Columns which aren't in the schema, such as those of removed properties, are left out.
+                auto it = property_names.find(column);
+                if (it != property_names.end())
+                    names.push_back(it->second);
+            }
+            std::sort(names.begin(), names.end());
+        }
+        return out;
+    }
+
+    template <class Keys>
+    static std::vector<std::string> sorted_keys(const Keys& keys)
+    {
+        std::vector<int64_t> sorted(keys.begin(), keys.end());
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<std::string> out;
+        out.reserve(sorted.size());
+        for (int64_t key : sorted)
+            out.push_back(std::to_string(key));
+        return out;
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/obj.hpp>
+#include <realm/object-store/results.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace realm {
+
+struct CollectionChangeKeys {
+    std::vector<std::string> deletions;
+    std::vector<std::string> insertions;
+    std::vector<std::string> modifications;
+};
+
+class CollectionKeyTracker;
+using SharedCollectionKeyTracker = std::shared_ptr<CollectionKeyTracker>;
+
+/**
+ * Translates the indices of collection change sets into the keys of the objects they refer to.
+ * Deleted objects are no longer in the collection when the change is delivered, so this keeps the keys of the
+ * objects as of the previous change, and patches them with every change set it is given.
+ */
+class CollectionKeyTracker {
+public:
+    // Must be called with the collection at the version of the first change set passed to `apply`.
+    static SharedCollectionKeyTracker make(Results& results)
+    {
+        auto tracker = std::make_shared<CollectionKeyTracker>();
+        tracker->rebuild(results);
+        return tracker;
+    }
+
+    // Indices are expected in ascending order, as they are unwound from the IndexSets of a CollectionChangeSet.
+    CollectionChangeKeys apply(Results& results, const std::vector<size_t>& deletions,
+                               const std::vector<size_t>& insertions, const std::vector<size_t>& modifications)
+    {
+        CollectionChangeKeys out;
+        out.deletions.reserve(deletions.size());
+        for (size_t index : deletions) {
+            if (index < m_keys.size())
+                out.deletions.push_back(to_string(m_keys[index]));
+        }
+
+        const size_t size = results.size();
+        if (m_keys.size() - out.deletions.size() + insertions.size() == size) {
+            // Merge the surviving keys with the inserted ones in a single pass.
+            std::vector<ObjKey> keys;
+            keys.reserve(size);
+            auto deletion = deletions.begin();
+            auto insertion = insertions.begin();
+            size_t old_index = 0;
+            for (size_t new_index = 0; new_index < size; ++new_index) {
+                if (insertion != insertions.end() && *insertion == new_index) {
+                    keys.push_back(results.get<Obj>(new_index).get_key());
+                    out.insertions.push_back(to_string(keys.back()));
+                    ++insertion;
+                    continue;
+                }
+                while (deletion != deletions.end() && *deletion == old_index) {
+                    ++deletion;
+                    ++old_index;
+                }
+                keys.push_back(m_keys[old_index++]);
+            }
+            m_keys = std::move(keys);
+        }
+        else {
+            // The change set doesn't add up, which would be a bug, but recovering is cheap enough.
+            rebuild(results);
+            for (size_t index : insertions) {
+                if (index < m_keys.size())
+                    out.insertions.push_back(to_string(m_keys[index]));
+            }
+        }
+
+        out.modifications.reserve(modifications.size());
+        for (size_t index : modifications) {
+            if (index < m_keys.size())
+                out.modifications.push_back(to_string(m_keys[index]));
+        }
+        return out;
+    }
+
+private:
+    void rebuild(Results& results)
+    {
+        const size_t size = results.size();
+        m_keys.clear();
+        m_keys.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            m_keys.push_back(results.get<Obj>(i).get_key());
+        }
+    }
+
+    // Matches how the SDK stringifies object keys, i.e. `Realm.Object#_objectKey()`.
+    static std::string to_string(ObjKey key)
+    {
+        return std::to_string(key.value);
+    }
+
+    std::vector<ObjKey> m_keys;
+};
+
+} // namespace realm
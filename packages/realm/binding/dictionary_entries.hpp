@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/mixed.hpp>
+#include <realm/object-store/dictionary.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace realm {
+
+// The keys of a dictionary and, unless only the keys were requested, their values in the same order.
+struct DictionaryEntries {
+    std::vector<std::string> keys;
+    std::vector<Mixed> values;
+};
+
+class JsDictionaryHelpers {
+public:
+    /**
+     * Read the entries of a dictionary in a single call, rather than a call per key and value.
+     * Only the keys starting with `prefix` are included, or only `keys` if not empty. Keys which don't exist are skipped.
+     */
+    static DictionaryEntries get_entries(const object_store::Dictionary& dictionary, const std::string& prefix,
+                                         const std::vector<std::string>& keys, bool include_values)
+    {
+        DictionaryEntries entries;
+        if (!keys.empty()) {
+            for (const auto& key : keys) {
+                auto value = dictionary.try_get_any(key);
+                if (!value || !has_prefix(key, prefix))
+                    continue;
+                entries.keys.push_back(key);
+                if (include_values)
+                    entries.values.push_back(*value);
+            }
+            return entries;
+        }
+
+        const size_t size = dictionary.size();
+        entries.keys.reserve(size);
+        if (include_values)
+            entries.values.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            auto [key, value] = dictionary.get_pair(i);
+            if (!has_prefix(key, prefix))
+                continue;
+            entries.keys.emplace_back(key);
+            if (include_values) {
+                // Consistent with try_get_any, which hides links to objects which were deleted by another client.
+                if (value.is_type(type_TypedLink) && value.get_link().get_obj_key().is_unresolved())
+                    value = Mixed();
+                entries.values.push_back(value);
+            }
+        }
+        return entries;
+    }
+
+private:
+    static bool has_prefix(std::string_view key, std::string_view prefix)
+    {
+        return key.substr(0, prefix.size()) == prefix;
+    }
+};
+
+} // namespace realm
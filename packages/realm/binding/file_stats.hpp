@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm/group.hpp>
+#include <realm/object-store/object_store.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/table.hpp>
+#include <realm/util/file.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace realm {
+
+struct TableFileStats {
+    std::string object_type;
+    size_t object_count = 0;
+    size_t byte_size = 0;
+};
+
+struct RealmFileStats {
+    size_t total_bytes = 0;
+    size_t used_bytes = 0;
+    size_t free_bytes = 0;
+    size_t history_bytes = 0;
+    size_t version = 0;
+    size_t number_of_versions = 0;
+    // Sorted by descending byte size.
+    std::vector<TableFileStats> largest_tables;
+};
+
+class JsFileStats {
+public:
+    /**
+     * Computes how the space of the Realm file is used, as seen from the version the Realm is currently at.
+     * This walks the nodes of every table, so it is proportional to the amount of live data and meant to be called
+     * occasionally, not on every write.
+     */
+    static RealmFileStats get_file_stats(const SharedRealm& realm, size_t max_tables)
+    {
+        const Group& group = realm->read_group();
+        RealmFileStats out;
+
+        out.used_bytes = group.compute_aggregated_byte_size(
+            Group::SizeAggregateControl(Group::size_of_state | Group::size_of_history));
+        out.history_bytes = group.compute_aggregated_byte_size(Group::size_of_history);
+        // In-memory Realms have no file, so everything allocated is in use.
+        out.total_bytes = realm->config().in_memory ? out.used_bytes
+                                                    : size_t(util::File::get_size_static(realm->config().path));
+        out.free_bytes = out.total_bytes > out.used_bytes ? out.total_bytes - out.used_bytes : 0;
+
+        if (auto version = realm->current_transaction_version())
+            out.version = size_t(version->version);
+        out.number_of_versions = size_t(realm->get_number_of_versions());
+
+        // Computing the size of every table walks all of their nodes, which isn't needed when none are included.
+        if (max_tables == 0)
+            return out;
+
+        for (auto key : group.get_table_keys()) {
+            auto table = group.get_table(key);
+            // Skip the internal tables, such as the metadata tables.
+            auto object_type = ObjectStore::object_type_for_table_name(table->get_name());
+            if (object_type.size() == 0)
+                continue;
+            out.largest_tables.push_back(
+                {std::string(object_type), table->size(), table->compute_aggregated_byte_size()});
+        }
+        std::sort(out.largest_tables.begin(), out.largest_tables.end(), [](const auto& a, const auto& b) {
+            return a.byte_size > b.byte_size;
+        });
+        if (out.largest_tables.size() > max_tables)
+            out.largest_tables.resize(max_tables);
+
+        return out;
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "background_config.hpp"
+#include "platform.hpp"
+
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/util/functional.hpp>
+
+#include <exception>
+#include <stdexcept>
+
+namespace realm {
+
+class JsFileTasks {
+public:
+    using CompactCallback = util::UniqueFunction<void(bool, std::exception_ptr)>;
+    using CompletionCallback = util::UniqueFunction<void(std::exception_ptr)>;
+
+    /**
+     * Compacts the Realm file in the background. The Realm is invalidated first, to release the version it pins,
+     * and the file is compacted through another instance owned by the background task. Like `Realm::compact`,
+     * this reports `false` when other processes have the file open.
+     */
+    static void compact(const SharedRealm& realm, CompactCallback on_complete)
+    {
+        if (realm->is_in_transaction())
+            throw std::logic_error("Can't compact a Realm within a write transaction");
+        realm->invalidate();
+
+        auto config = js::background_config(realm->config());
+        JsPlatformHelpers::run_in_background(
+            [config = std::move(config), on_complete = std::move(on_complete)]() mutable {
+                bool compacted = false;
+                try {
+                    auto compactor = Realm::get_shared_realm(std::move(config));
+                    compacted = compactor->compact();
+                    compactor->close();
+                }
+                catch (...) {
+                    on_complete(false, std::current_exception());
+                    return;
+                }
+                on_complete(compacted, nullptr);
+            });
+    }
+
+    /**
+     * Writes a compacted copy of the Realm, as of the version it is currently at, in the background.
+     */
+    static void write_copy(const SharedRealm& realm, RealmConfig config, CompletionCallback on_complete)
+    {
+        if (realm->is_in_transaction())
+            throw std::logic_error("Can't write a copy of a Realm within a write transaction");
+
+        // The frozen Realm can be used from any thread, and keeps the version alive until it is copied.
+        auto frozen_realm = realm->freeze();
+        JsPlatformHelpers::run_in_background([frozen_realm = std::move(frozen_realm), config = std::move(config),
+                                              on_complete = std::move(on_complete)]() mutable {
+            try {
+                frozen_realm->convert(config);
+                frozen_realm->close();
+            }
+            catch (...) {
+                on_complete(std::current_exception());
+                return;
+            }
+            on_complete(nullptr);
+        });
+    }
+};
+
+} // namespace realm
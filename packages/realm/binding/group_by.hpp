@@ -0,0 +1,354 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "platform.hpp"
+
+#include <realm/mixed.hpp>
+#include <realm/obj.hpp>
+#include <realm/object-store/object_schema.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/table.hpp>
+#include <realm/util/functional.hpp>
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace realm {
+
+struct GroupedAggregates {
+    // One column per key path and one per aggregate, with a row per group, in the order the groups were first seen.
+    std::vector<std::vector<Mixed>> keys;
+    std::vector<std::vector<Mixed>> values;
+    // String and binary keys point into the Realm file, so this keeps their version alive until they're converted.
+    std::shared_ptr<Realm> source;
+};
+
+namespace js {
+namespace group_by {
+
+enum class AggregateOp { count, sum, min, max, avg };
+
+inline AggregateOp parse_op(std::string_view op)
+{
+    if (op == "count")
+        return AggregateOp::count;
+    if (op == "sum")
+        return AggregateOp::sum;
+    if (op == "min")
+        return AggregateOp::min;
+    if (op == "max")
+        return AggregateOp::max;
+    if (op == "avg")
+        return AggregateOp::avg;
+    throw std::invalid_argument("Unsupported aggregate operation '" + std::string(op) + "'");
+}
+
+// The links to follow from an object of the results, and the column to read from the object reached.
+struct KeyPath {
+    std::vector<ColKey> links;
+    ColKey column;
+
+    Mixed get(const Obj& obj) const
+    {
+        if (links.empty())
+            return obj.get_any(column);
+        Obj current = obj;
+        for (auto link : links) {
+            current = current.get_linked_object(link);
+            if (!current.is_valid())
+                return Mixed();
+        }
+        return current.get_any(column);
+    }
+};
+
+// Resolves a key path of public property names, through to-one links, such as "customer.name".
+inline KeyPath resolve_key_path(const Realm& realm, const std::string& object_type, const std::string& path)
+{
+    KeyPath out;
+    const ObjectSchema* object_schema = &*realm.schema().find(object_type);
+    size_t begin = 0;
+    while (true) {
+        const size_t end = path.find('.', begin);
+        const std::string name = path.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        const Property* property = object_schema->property_for_public_name(name);
+        if (!property)
+            throw std::invalid_argument("Property '" + name + "' does not exist on '" + object_schema->name +
+                                        "' objects");
+        const ColKey key = property->column_key;
+        if (!key || key.is_collection())
+            throw std::invalid_argument("Property '" + path + "' can't be used, only properties of primitive types " +
+                                        "and links to objects can");
+        if (end == std::string::npos) {
+            out.column = key;
+            return out;
+        }
+        if (key.get_type() != col_type_Link)
+            throw std::invalid_argument("Property '" + name + "' of '" + path + "' is not a link to an object");
+        out.links.push_back(key);
+        object_schema = &*realm.schema().find(property->object_type);
+        begin = end + 1;
+    }
+}
+
+struct Aggregate {
+    AggregateOp op;
+    // Unset when counting objects.
+    KeyPath path;
+    bool has_path = false;
+    bool is_int = false;
+};
+
+inline Aggregate resolve_aggregate(const Realm& realm, const std::string& object_type, const std::string& op,
+                                   const std::string& path)
+{
+    Aggregate out{parse_op(op)};
+    if (path.empty()) {
+        if (out.op != AggregateOp::count)
+            throw std::invalid_argument("The '" + op + "' aggregate needs a property");
+        return out;
+    }
+    out.path = resolve_key_path(realm, object_type, path);
+    out.has_path = true;
+    const auto type = out.path.column.get_type();
+    if (type == col_type_Link)
+        throw std::invalid_argument("Can't aggregate the link '" + path + "', use a property of the linked object");
+    const bool numeric = type == col_type_Int || type == col_type_Float || type == col_type_Double;
+    if ((out.op == AggregateOp::sum || out.op == AggregateOp::avg) && !numeric)
+        throw std::invalid_argument("Can't compute the '" + op + "' of '" + path +
+                                    "', only of int, float and double properties");
+    if ((out.op == AggregateOp::min || out.op == AggregateOp::max) && !numeric && type != col_type_Timestamp)
+        throw std::invalid_argument("Can't compute the '" + op + "' of '" + path +
+                                    "', only of int, float, double and date properties");
+    out.is_int = type == col_type_Int;
+    return out;
+}
+
+struct Accumulator {
+    size_t count = 0;
+    int64_t int_sum = 0;
+    double double_sum = 0;
+    // The minimum or maximum, which is never a string, so it doesn't need to own its data.
+    Mixed extreme;
+};
+
+inline double to_double(Mixed value)
+{
+    switch (value.get_type()) {
+        case type_Int:
+            return double(value.get_int());
+        case type_Float:
+            return value.get_float();
+        default:
+            return value.get_double();
+    }
+}
+
+struct KeyHash {
+    size_t operator()(const std::vector<Mixed>& key) const noexcept
+    {
+        size_t hash = 0;
+        for (const auto& value : key)
+            hash = hash * 31 + std::hash<Mixed>()(value);
+        return hash;
+    }
+};
+
+inline GroupedAggregates run(Results& results, const std::vector<KeyPath>& key_paths,
+                             const std::vector<Aggregate>& aggregates)
+{
+    GroupedAggregates out;
+    out.keys.resize(key_paths.size());
+    out.values.resize(aggregates.size());
+
+    // The keys point into the Realm file, which is fine as it doesn't change while this runs.
+    std::unordered_map<std::vector<Mixed>, size_t, KeyHash> groups;
+    std::vector<Accumulator> accumulators;
+    std::vector<Mixed> key(key_paths.size());
+
+    const size_t size = results.size();
+    for (size_t row = 0; row < size; row++) {
+        const Obj obj = results.get<Obj>(row);
+        for (size_t i = 0; i < key_paths.size(); i++) {
+            key[i] = key_paths[i].get(obj);
+            if (key[i].is_type(type_Link, type_TypedLink, type_List, type_Dictionary))
+                throw std::invalid_argument("Can't group by mixed values holding links or collections");
+        }
+
+        auto [it, inserted] = groups.try_emplace(key, groups.size());
+        const size_t group = it->second;
+        if (inserted) {
+            for (size_t i = 0; i < key.size(); i++)
+                out.keys[i].push_back(key[i]);
+            accumulators.resize(accumulators.size() + aggregates.size());
+        }
+
+        Accumulator* accumulator = &accumulators[group * aggregates.size()];
+        for (const auto& aggregate : aggregates) {
+            if (!aggregate.has_path) {
+                accumulator->count++;
+                accumulator++;
+                continue;
+            }
+            const Mixed value = aggregate.path.get(obj);
+            if (value.is_null()) {
+                accumulator++;
+                continue;
+            }
+            accumulator->count++;
+            switch (aggregate.op) {
+                case AggregateOp::sum:
+                case AggregateOp::avg:
+                    if (aggregate.is_int)
+                        accumulator->int_sum += value.get_int();
+                    else
+                        accumulator->double_sum += to_double(value);
+                    break;
+                case AggregateOp::min:
+                    if (accumulator->extreme.is_null() || value.compare(accumulator->extreme) < 0)
+                        accumulator->extreme = value;
+                    break;
+                case AggregateOp::max:
+                    if (accumulator->extreme.is_null() || value.compare(accumulator->extreme) > 0)
+                        accumulator->extreme = value;
+                    break;
+                case AggregateOp::count:
+                    break;
+            }
+            accumulator++;
+        }
+    }
+
+    const size_t group_count = groups.size();
+    for (size_t i = 0; i < aggregates.size(); i++) {
+        const auto& aggregate = aggregates[i];
+        auto& column = out.values[i];
+        column.reserve(group_count);
+        for (size_t group = 0; group < group_count; group++) {
+            const auto& accumulator = accumulators[group * aggregates.size() + i];
+            switch (aggregate.op) {
+                case AggregateOp::count:
+                    column.push_back(Mixed(int64_t(accumulator.count)));
+                    break;
+                case AggregateOp::sum:
+                    column.push_back(aggregate.is_int ? Mixed(accumulator.int_sum) : Mixed(accumulator.double_sum));
+                    break;
+                case AggregateOp::avg:
+                    if (accumulator.count == 0) {
+                        column.push_back(Mixed());
+                    }
+                    else {
+                        const double sum = aggregate.is_int ? double(accumulator.int_sum) : accumulator.double_sum;
+                        column.push_back(Mixed(sum / double(accumulator.count)));
+                    }
+                    break;
+                case AggregateOp::min:
+                case AggregateOp::max:
+                    column.push_back(accumulator.extreme);
+                    break;
+            }
+        }
+    }
+    return out;
+}
+
+} // namespace group_by
+} // namespace js
+
+class JsGroupBy {
+public:
+    using CompletionCallback = util::UniqueFunction<void(GroupedAggregates, std::exception_ptr)>;
+
+    /**
+     * Groups the objects of `results` by the values of `key_paths` and computes the aggregates, given as pairs of
+     * `operations` and `operands` (an empty operand counts the objects), per group in a single pass.
+     */
+    static GroupedAggregates aggregate(const SharedRealm& realm, Results& results,
+                                       const std::vector<std::string>& key_paths,
+                                       const std::vector<std::string>& operations,
+                                       const std::vector<std::string>& operands)
+    {
+        std::vector<js::group_by::KeyPath> keys;
+        std::vector<js::group_by::Aggregate> aggregates;
+        resolve(*realm, results, key_paths, operations, operands, keys, aggregates);
+        return js::group_by::run(results, keys, aggregates);
+    }
+
+    /**
+     * Like `aggregate`, but on a background thread, over the version the Realm is currently at.
+     */
+    static void aggregate_async(const SharedRealm& realm, Results& results, const std::vector<std::string>& key_paths,
+                                const std::vector<std::string>& operations,
+                                const std::vector<std::string>& operands, CompletionCallback on_complete)
+    {
+        std::vector<js::group_by::KeyPath> keys;
+        std::vector<js::group_by::Aggregate> aggregates;
+        resolve(*realm, results, key_paths, operations, operands, keys, aggregates);
+
+        // The frozen Realm and Results can be used from any thread, and keep the version alive until converted.
+        auto frozen_realm = realm->freeze();
+        auto frozen_results = results.freeze(frozen_realm);
+        JsPlatformHelpers::run_in_background([frozen_realm = std::move(frozen_realm),
+                                              frozen_results = std::move(frozen_results), keys = std::move(keys),
+                                              aggregates = std::move(aggregates),
+                                              on_complete = std::move(on_complete)]() mutable {
+            GroupedAggregates out;
+            try {
+                out = js::group_by::run(frozen_results, keys, aggregates);
+                out.source = std::move(frozen_realm);
+            }
+            catch (...) {
+                on_complete(std::move(out), std::current_exception());
+                return;
+            }
+            on_complete(std::move(out), nullptr);
+        });
+    }
+
+private:
+    static void resolve(const Realm& realm, Results& results, const std::vector<std::string>& key_paths,
+                        const std::vector<std::string>& operations, const std::vector<std::string>& operands,
+                        std::vector<js::group_by::KeyPath>& keys, std::vector<js::group_by::Aggregate>& aggregates)
+    {
+        if (results.get_type() != PropertyType::Object)
+            throw std::invalid_argument("Only collections of objects can be grouped");
+        if (operations.size() != operands.size())
+            throw std::invalid_argument("Expected an operand per aggregate operation");
+        const std::string object_type(results.get_object_type());
+        for (const auto& path : key_paths) {
+            keys.push_back(js::group_by::resolve_key_path(realm, object_type, path));
+            if (keys.back().column.get_type() == col_type_Link)
+                throw std::invalid_argument("Can't group by the link '" + path +
+                                            "', use a property of the linked object");
+        }
+        for (size_t i = 0; i < operations.size(); i++)
+            aggregates.push_back(js::group_by::resolve_aggregate(realm, object_type, operations[i], operands[i]));
+    }
+};
+
+} // namespace realm
@@ -17,6 +17,7 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #include "react_scheduler.h"
+#include "../trace_events.hpp"
 
 #include <realm/object-store/util/scheduler.hpp>
 
@@ -60,6 +61,7 @@ public:
         // TODO: We could pass a callback taking a `jsi::Runtime` as first argument
         // Doing either would require our peer dependency on `react-native` to be >= 0.75.0
         m_js_call_invoker->invokeAsync([ptr = func.release()] {
+            realm::js::trace::TraceScope scope("scheduler", "ReactScheduler::invoke");
             (realm::util::UniqueFunction<void()>(ptr))();
         });
     }
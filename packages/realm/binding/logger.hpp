@@ -17,137 +17,342 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #pragma once
-#include <iostream>
-#include <memory>
-#include <queue>
+
+#include "json_string.hpp"
+#include "trace_events.hpp"
 
 #include <realm/util/logger.hpp>
-#include <realm/object-store/sync/sync_manager.hpp> // SyncLoggerFactory
-#include <realm/object-store/util/scheduler.hpp>    // realm::util::Scheduler
 
-#if REALM_ANDROID
-#include <android/log.h>
-#endif
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace realm {
-namespace common {
+namespace js {
 namespace logger {
 
-using LoggerLevel = realm::util::Logger::Level;
+using LoggerLevel = util::Logger::Level;
 
-// TODO we are coupling core with JS Land here, change to string.
-using Entry = std::pair<LoggerLevel, std::string>;
-using Delegated = std::function<void(int, std::string)>;
+enum class LogFormat { text, json };
 
 /*
- * The idea here is to one day implement a functionality to delegate the logs
- * to the mobile OS, for that we got two specialized behaviour that we can
- * inject at compile time or at runtime.
- *
+ * Destination of formatted log lines. Only ever called from the writer thread.
  */
+class LogOutput {
+public:
+    virtual ~LogOutput() = default;
+    virtual void write(std::string_view line) = 0;
+    virtual void flush() = 0;
+};
 
-#if REALM_ANDROID
-class AndroidLogger {
-    std::map<LoggerLevel, android_LogPriority> map_android_log_level{
-        {LoggerLevel::all, ANDROID_LOG_VERBOSE},    {LoggerLevel::info, ANDROID_LOG_INFO},
-        {LoggerLevel::trace, ANDROID_LOG_DEFAULT},  {LoggerLevel::debug, ANDROID_LOG_DEBUG},
-        {LoggerLevel::detail, ANDROID_LOG_VERBOSE}, {LoggerLevel::warn, ANDROID_LOG_WARN},
-        {LoggerLevel::error, ANDROID_LOG_ERROR},    {LoggerLevel::fatal, ANDROID_LOG_FATAL},
-        {LoggerLevel::off, ANDROID_LOG_SILENT},
-    };
+class StderrOutput final : public LogOutput {
+public:
+    void write(std::string_view line) override
+    {
+        std::fwrite(line.data(), 1, line.size(), stderr);
+    }
 
-    void print(Entry& entry)
+    void flush() override
     {
-        auto android_log_level = map_android_log_level[entry.first];
-        __android_log_print(android_log_level, "realm", "%s", entry.second.c_str());
+        std::fflush(stderr);
     }
 };
-#endif
 
-#ifdef __APPLE__
-class IOSLogger {
-    void print() {}
+/*
+ * Appends to a file, rotating it once it would grow beyond `max_file_size` bytes:
+ * "path" is renamed to "path.1", "path.1" to "path.2" and so on, keeping at most `max_files` old files.
+ */
+class RotatingFileOutput final : public LogOutput {
+public:
+    RotatingFileOutput(std::string path, size_t max_file_size, size_t max_files)
+        : m_path(std::move(path))
+        , m_max_file_size(max_file_size)
+        , m_max_files(max_files)
+    {
+        open();
+    }
+
+    ~RotatingFileOutput()
+    {
+        if (m_file)
+            std::fclose(m_file);
+    }
+
+    void write(std::string_view line) override
+    {
+        if (m_max_file_size != 0 && m_size != 0 && m_size + line.size() > m_max_file_size)
+            rotate();
+        if (!m_file)
+            return;
+        m_size += std::fwrite(line.data(), 1, line.size(), m_file);
+    }
+
+    void flush() override
+    {
+        if (m_file)
+            std::fflush(m_file);
+    }
+
+private:
+    void open()
+    {
+        m_file = std::fopen(m_path.c_str(), "ab");
+        if (!m_file)
+            throw std::runtime_error("Failed to open log file '" + m_path + "'");
+        std::fseek(m_file, 0, SEEK_END);
+        const auto size = std::ftell(m_file);
+        m_size = size > 0 ? size_t(size) : 0;
+    }
+
+    void rotate()
+    {
+        std::fclose(m_file);
+        m_file = nullptr;
+        if (m_max_files == 0) {
+            std::remove(m_path.c_str());
+        }
+        else {
+            std::remove(rotated_path(m_max_files).c_str());
+            for (size_t i = m_max_files - 1; i > 0; i--) {
+                std::rename(rotated_path(i).c_str(), rotated_path(i + 1).c_str());
+            }
+            std::rename(m_path.c_str(), rotated_path(1).c_str());
+        }
+        try {
+            open();
+        }
+        catch (const std::runtime_error&) {
+            // Nowhere to report this, so drop the messages until the next rotation rather than crashing the writer.
+            m_size = 0;
+        }
+    }
+
+    std::string rotated_path(size_t index) const
+    {
+        return m_path + "." + std::to_string(index);
+    }
+
+    const std::string m_path;
+    const size_t m_max_file_size;
+    const size_t m_max_files;
+    std::FILE* m_file = nullptr;
+    size_t m_size = 0;
 };
-#endif
 
-class SyncLoggerDelegator : public util::Logger {
+/*
+ * Writes lines to a LogOutput from a dedicated thread, such that logging never blocks on I/O.
+ * Lines logged while the queue is full are dropped, and the number of dropped lines is written once there's room.
+ */
+class AsyncLogWriter {
 public:
-    SyncLoggerDelegator() = delete;
-    SyncLoggerDelegator(Delegated&& delegate)
-        : loggerDelegate(delegate){};
+    static constexpr size_t max_queued_lines = 10000;
 
-    void delegate() {}
+    explicit AsyncLogWriter(std::unique_ptr<LogOutput> output)
+        : m_output(std::move(output))
+        , m_thread([this] {
+            run();
+        })
+    {
+    }
 
-protected:
-    void do_log(LoggerLevel level, const std::string& message)
+    ~AsyncLogWriter()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+    }
 
-        // TODO we are coupling core with JS here, change to string use hashmap
-        // map_level.
-        auto entry = std::make_pair(level, message);
+    void write(std::string line)
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_queue.size() >= max_queued_lines) {
+                ++m_dropped;
+                return;
+            }
+            m_queue.push_back(std::move(line));
+        }
+        m_cv.notify_one();
+    }
+
+private:
+    void run()
+    {
+        trace::TraceRecorder::set_thread_name("Realm log writer");
+        std::vector<std::string> lines;
+        std::unique_lock lock(m_mutex);
+        while (true) {
+            m_cv.wait(lock, [this] {
+                return m_stopping || !m_queue.empty();
+            });
+            if (m_queue.empty() && m_stopping)
+                break;
+            lines.swap(m_queue);
+            const size_t dropped = std::exchange(m_dropped, 0);
+            lock.unlock();
 
-        m_log_queue.push(entry);
-        m_scheduler->invoke([this] {
-            std::queue<Entry> popped;
             {
-                std::lock_guard<std::mutex> lock(m_mutex); // Throws
-                popped.swap(m_log_queue);
+                trace::TraceScope scope("logger", "drain");
+                if (trace::TraceRecorder::is_enabled())
+                    scope.set_detail(std::to_string(lines.size()) + " lines");
+                for (const auto& line : lines) {
+                    m_output->write(line);
+                }
+                if (dropped != 0) {
+                    m_output->write(std::to_string(dropped) + " log messages were dropped, as they were logged "
+                                                              "faster than they could be written\n");
+                }
+                m_output->flush();
             }
+            lines.clear();
 
-            while (!popped.empty()) {
-                Entry& entry = popped.front();
-                loggerDelegate(static_cast<int>(entry.first), entry.second);
-                popped.pop();
-            }
-        });
+            lock.lock();
+        }
     }
 
-private:
-    std::queue<Entry> m_log_queue;
-    std::shared_ptr<util::Scheduler> m_scheduler = util::Scheduler::make_default();
+    const std::unique_ptr<LogOutput> m_output;
     std::mutex m_mutex;
-    Delegated loggerDelegate;
+    std::condition_variable m_cv;
+    std::vector<std::string> m_queue;
+    size_t m_dropped = 0;
+    bool m_stopping = false;
+    // Must be declared last, as it starts running before the constructor body.
+    std::thread m_thread;
 };
 
-class Logger {
+inline const char* level_name(LoggerLevel level)
+{
+    switch (level) {
+        case LoggerLevel::all:
+            return "all";
+        case LoggerLevel::trace:
+            return "trace";
+        case LoggerLevel::debug:
+            return "debug";
+        case LoggerLevel::detail:
+            return "detail";
+        case LoggerLevel::info:
+            return "info";
+        case LoggerLevel::warn:
+            return "warn";
+        case LoggerLevel::error:
+            return "error";
+        case LoggerLevel::fatal:
+            return "fatal";
+        case LoggerLevel::off:
+            return "off";
+    }
+    return "unknown";
+}
+
+// ISO 8601 in UTC with millisecond precision, e.g. "2024-01-31T12:34:56.789Z".
+inline std::string format_timestamp(std::chrono::system_clock::time_point now)
+{
+    const auto time = std::chrono::system_clock::to_time_t(now);
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+    std::tm tm{};
+#ifdef _WIN32
+    gmtime_s(&tm, &time);
+#else
+    gmtime_r(&time, &tm);
+#endif
+    char buffer[32];
+    const auto length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &tm);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03dZ", int(ms));
+    return buffer;
+}
+
+inline std::string format_entry(LogFormat format, std::string_view category, LoggerLevel level,
+                                std::string_view message)
+{
+    const auto timestamp = format_timestamp(std::chrono::system_clock::now());
+    std::string out;
+    out.reserve(message.size() + category.size() + 64);
+    if (format == LogFormat::json) {
+        out += "{\"time\":\"";
+        out += timestamp;
+        out += "\",\"category\":";
+        append_json_string(out, category);
+        out += ",\"level\":\"";
+        out += level_name(level);
+        out += "\",\"message\":";
+        append_json_string(out, message);
+        out += "}\n";
+    }
+    else {
+        out += timestamp;
+        out += " [";
+        out += category;
+        out += "] ";
+        out += level_name(level);
+        out += ": ";
+        out += message;
+        out += '\n';
+    }
+    return out;
+}
+
+/*
+ * A logger which formats messages on the logging thread and writes them from a background thread,
+ * never involving the JS thread. Levels are controlled per category like for any other logger.
+ */
+class AsyncSinkLogger final : public util::Logger {
+public:
+    AsyncSinkLogger(std::unique_ptr<LogOutput> output, LogFormat format)
+        : m_format(format)
+        , m_writer(std::move(output))
+    {
+    }
+
+protected:
+    void do_log(const util::LogCategory& category, Level level, const std::string& message) override
+    {
+        m_writer.write(format_entry(m_format, category.get_name(), level, message));
+    }
+
 private:
-    // Warning: If this grows to big (for example: another method) we should
-    // make this class non-static.
-    /*
-       Log levels available.
-       More info in (realm-core) realm/util/logger.hpp
-
-       [ all, trace, debug, detail, info, warn, error, fatal, off ]
-    */
-    const static inline std::map<LoggerLevel, std::string> map_level = {
-        {LoggerLevel::all, "all"},     {LoggerLevel::info, "info"},     {LoggerLevel::trace, "trace"},
-        {LoggerLevel::debug, "debug"}, {LoggerLevel::detail, "detail"}, {LoggerLevel::warn, "warn"},
-        {LoggerLevel::error, "error"}, {LoggerLevel::fatal, "fatal"},   {LoggerLevel::off, "off"},
-    };
+    const LogFormat m_format;
+    AsyncLogWriter m_writer;
+};
+
+} // namespace logger
+} // namespace js
 
+class JsLogSinks {
 public:
-    static LoggerLevel get_level(const std::string level)
+    // Log to a file, rotating it when it exceeds `max_file_size` bytes (or never, if 0).
+    static std::shared_ptr<util::Logger> make_file_logger(const std::string& path, size_t max_file_size,
+                                                          size_t max_files, bool json)
     {
-        for (auto const& [key, value] : Logger::map_level) {
-            if (value == level)
-                return key;
-        }
+        using namespace js::logger;
+        return std::make_shared<AsyncSinkLogger>(std::make_unique<RotatingFileOutput>(path, max_file_size, max_files),
+                                                 json ? LogFormat::json : LogFormat::text);
+    }
 
-        throw std::runtime_error("Bad log level");
+    static std::shared_ptr<util::Logger> make_stderr_logger(bool json)
+    {
+        using namespace js::logger;
+        return std::make_shared<AsyncSinkLogger>(std::make_unique<StderrOutput>(),
+                                                 json ? LogFormat::json : LogFormat::text);
     }
 
-    static SyncClientConfig::LoggerFactory build_sync_logger(Delegated&& log_fn)
+    // Log a message from the SDK to the default logger, subject to the level set for its category.
+    static void log(const std::string& category, util::Logger::Level level, const std::string& message)
     {
-        return [captured_logger = std::move(log_fn)](realm::util::Logger::Level level) mutable {
-            auto logger = std::make_unique<SyncLoggerDelegator>(std::move(captured_logger));
-            logger->set_level_threshold(level);
-            logger->delegate();
-            return logger;
-        };
+        util::Logger::get_default_logger()->log(util::LogCategory::get_category(category), level, "%1", message);
     }
 };
 
-} // namespace logger
-} // namespace common
 } // namespace realm
@@ -0,0 +1,215 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/dictionary.hpp>
+#include <realm/list.hpp>
+#include <realm/obj.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace realm {
+
+/**
+ * A tree of mixed values, nested lists and dictionaries, flattened in pre-order such that it crosses between JS and
+ * C++ in one piece. `shape` has a node kind per node, followed by the number of items for lists and dictionaries.
+ * `keys` has the key of every dictionary entry and `values` every value which isn't a collection, in order.
+ */
+struct MixedTree {
+    std::vector<size_t> shape;
+    std::vector<std::string> keys;
+    std::vector<Mixed> values;
+};
+
+/**
+ * Writes and reads whole trees of nested collections in mixed properties, rather than a collection at a time.
+ */
+class JsMixedTree {
+public:
+    enum NodeKind : size_t { value_node = 0, list_node = 1, dictionary_node = 2 };
+
+    // Replaces the value of the property. Must be called in a write transaction.
+    static void write(Obj& obj, ColKey column, const MixedTree& tree)
+    {
+        Reader reader{tree};
+        switch (reader.next_shape()) {
+            case value_node:
+                obj.set_any(column, reader.next_value());
+                break;
+            case list_node: {
+                const size_t count = reader.next_shape();
+                obj.set_collection(column, CollectionType::List);
+                auto list = obj.get_list<Mixed>(column);
+                write_list(list, count, reader);
+                break;
+            }
+            case dictionary_node: {
+                const size_t count = reader.next_shape();
+                obj.set_collection(column, CollectionType::Dictionary);
+                auto dictionary = obj.get_dictionary(column);
+                write_dictionary(dictionary, count, reader);
+                break;
+            }
+            default:
+                throw std::invalid_argument("Unexpected node in mixed tree");
+        }
+    }
+
+    static MixedTree read(const Obj& obj, ColKey column)
+    {
+        MixedTree tree;
+        const Mixed value = obj.get_any(column);
+        if (value.is_type(type_List)) {
+            read_list(obj.get_list<Mixed>(column), tree);
+        }
+        else if (value.is_type(type_Dictionary)) {
+            read_dictionary(obj.get_dictionary(column), tree);
+        }
+        else {
+            tree.shape.push_back(value_node);
+            tree.values.push_back(value);
+        }
+        return tree;
+    }
+
+private:
+    struct Reader {
+        const MixedTree& tree;
+        size_t shape_index = 0;
+        size_t key_index = 0;
+        size_t value_index = 0;
+
+        size_t next_shape()
+        {
+            if (shape_index >= tree.shape.size())
+                throw std::invalid_argument("Mixed tree ended unexpectedly");
+            return tree.shape[shape_index++];
+        }
+
+        StringData next_key()
+        {
+            if (key_index >= tree.keys.size())
+                throw std::invalid_argument("Mixed tree ended unexpectedly");
+            return tree.keys[key_index++];
+        }
+
+        Mixed next_value()
+        {
+            if (value_index >= tree.values.size())
+                throw std::invalid_argument("Mixed tree ended unexpectedly");
+            return tree.values[value_index++];
+        }
+    };
+
+    static void write_list(Lst<Mixed>& list, size_t count, Reader& reader)
+    {
+        for (size_t index = 0; index < count; ++index) {
+            switch (reader.next_shape()) {
+                case value_node:
+                    list.insert_any(index, reader.next_value());
+                    break;
+                case list_node: {
+                    const size_t child_count = reader.next_shape();
+                    list.insert_collection(index, CollectionType::List);
+                    write_list(*list.get_list(index), child_count, reader);
+                    break;
+                }
+                case dictionary_node: {
+                    const size_t child_count = reader.next_shape();
+                    list.insert_collection(index, CollectionType::Dictionary);
+                    write_dictionary(*list.get_dictionary(index), child_count, reader);
+                    break;
+                }
+                default:
+                    throw std::invalid_argument("Unexpected node in mixed tree");
+            }
+        }
+    }
+
+    static void write_dictionary(Dictionary& dictionary, size_t count, Reader& reader)
+    {
+        for (size_t index = 0; index < count; ++index) {
+            const StringData key = reader.next_key();
+            switch (reader.next_shape()) {
+                case value_node:
+                    dictionary.insert(key, reader.next_value());
+                    break;
+                case list_node: {
+                    const size_t child_count = reader.next_shape();
+                    dictionary.insert_collection(key, CollectionType::List);
+                    write_list(*dictionary.get_list(key), child_count, reader);
+                    break;
+                }
+                case dictionary_node: {
+                    const size_t child_count = reader.next_shape();
+                    dictionary.insert_collection(key, CollectionType::Dictionary);
+                    write_dictionary(*dictionary.get_dictionary(key), child_count, reader);
+                    break;
+                }
+                default:
+                    throw std::invalid_argument("Unexpected node in mixed tree");
+            }
+        }
+    }
+
+    static void read_list(const Lst<Mixed>& list, MixedTree& tree)
+    {
+        const size_t size = list.size();
+        tree.shape.push_back(list_node);
+        tree.shape.push_back(size);
+        for (size_t index = 0; index < size; ++index) {
+            const Mixed value = list.get_any(index);
+            if (value.is_type(type_List)) {
+                read_list(*list.get_list(index), tree);
+            }
+            else if (value.is_type(type_Dictionary)) {
+                read_dictionary(*list.get_dictionary(index), tree);
+            }
+            else {
+                tree.shape.push_back(value_node);
+                tree.values.push_back(value);
+            }
+        }
+    }
+
+    static void read_dictionary(const Dictionary& dictionary, MixedTree& tree)
+    {
+        const size_t size = dictionary.size();
+        tree.shape.push_back(dictionary_node);
+        tree.shape.push_back(size);
+        for (size_t index = 0; index < size; ++index) {
+            const auto [key, value] = dictionary.get_pair(index);
+            const std::string name = key.get_string();
+            tree.keys.push_back(name);
+            if (value.is_type(type_List)) {
+                read_list(*dictionary.get_list(name), tree);
+            }
+            else if (value.is_type(type_Dictionary)) {
+                read_dictionary(*dictionary.get_dictionary(name), tree);
+            }
+            else {
+                tree.shape.push_back(value_node);
+                tree.values.push_back(value);
+            }
+        }
+    }
+};
+
+} // namespace realm
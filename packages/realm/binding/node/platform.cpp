@@ -16,27 +16,53 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+#include <memory>
 #include <stdexcept>
+#include <system_error>
 #include <vector>
 #include <stdarg.h>
 #include <stdio.h>
 #include <uv.h>
 
+#include <realm/util/to_string.hpp>
+
 #include "../platform.hpp"
 
 static std::string s_default_realm_directory;
 
 namespace realm {
 
-class UVException : public std::runtime_error {
+class UVErrorCategory : public std::error_category {
+public:
+    const char* name() const noexcept override
+    {
+        return "uv";
+    }
+
+    std::string message(int error) const override
+    {
+        return uv_strerror(error);
+    }
+};
+
+const std::error_category& uv_category() noexcept
+{
+    static UVErrorCategory category;
+    return category;
+}
+
+// carries the libuv error code, so it can be surfaced as the `code` of the JS error
+class UVException : public std::system_error {
 public:
     UVException(uv_errno_t error)
-        : std::runtime_error(uv_strerror(error))
-        , m_error(error)
+        : std::system_error(error, uv_category())
     {
     }
 
-    const uv_errno_t m_error;
+    UVException(int error, const char* syscall, const std::string& path)
+        : std::system_error(error, uv_category(), util::format("%1 '%2'", syscall, path))
+    {
+    }
 };
 
 struct FileSystemRequest : uv_fs_t {
@@ -46,6 +72,150 @@ struct FileSystemRequest : uv_fs_t {
     }
 };
 
+namespace {
+
+// a set of file system requests running concurrently on the libuv threadpool. the callback is called with the first
+// error (if any) once the group is released by the last request still referring to it
+class RequestGroup {
+public:
+    RequestGroup(JsPlatformHelpers::CompletionCallback callback)
+        : m_callback(std::move(callback))
+    {
+    }
+
+    ~RequestGroup()
+    {
+        m_callback(m_error);
+    }
+
+    void fail(std::exception_ptr error)
+    {
+        if (!m_error) {
+            m_error = std::move(error);
+        }
+    }
+
+private:
+    JsPlatformHelpers::CompletionCallback m_callback;
+    std::exception_ptr m_error;
+};
+
+struct AsyncFileSystemRequest : uv_fs_t {
+    using Continuation = util::UniqueFunction<void(AsyncFileSystemRequest&)>;
+
+    std::string path;
+    std::shared_ptr<RequestGroup> group;
+    Continuation then;
+
+    ~AsyncFileSystemRequest()
+    {
+        uv_fs_req_cleanup(this);
+    }
+};
+
+// issue an asynchronous request through `submit`, calling `then` on the loop thread once it completed.
+// errors thrown by the continuation fail the group
+template <typename Submit>
+void submit_request(std::shared_ptr<RequestGroup> group, std::string path, const char* syscall, Submit submit,
+                    AsyncFileSystemRequest::Continuation then)
+{
+    auto req = std::make_unique<AsyncFileSystemRequest>();
+    req->path = std::move(path);
+    req->group = std::move(group);
+    req->then = std::move(then);
+    int err = submit(uv_default_loop(), req.get(), req->path.c_str(), [](uv_fs_t* fs_req) {
+        std::unique_ptr<AsyncFileSystemRequest> req(static_cast<AsyncFileSystemRequest*>(fs_req));
+        try {
+            req->then(*req);
+        }
+        catch (...) {
+            req->group->fail(std::current_exception());
+        }
+    });
+    if (err < 0) {
+        req->group->fail(std::make_exception_ptr(UVException(err, syscall, req->path)));
+        return;
+    }
+    req.release();
+}
+
+void unlink_async(std::shared_ptr<RequestGroup> group, std::string path)
+{
+    submit_request(
+        std::move(group), std::move(path), "unlink",
+        [](uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+            return uv_fs_unlink(loop, req, path, cb);
+        },
+        [](AsyncFileSystemRequest& req) {
+            // a file that is already gone is not an error
+            if (req.result < 0 && req.result != UV_ENOENT) {
+                throw UVException(static_cast<int>(req.result), "unlink", req.path);
+            }
+        });
+}
+
+void rmdir_async(std::shared_ptr<RequestGroup> group, std::string path)
+{
+    submit_request(
+        std::move(group), std::move(path), "rmdir",
+        [](uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+            return uv_fs_rmdir(loop, req, path, cb);
+        },
+        [](AsyncFileSystemRequest& req) {
+            if (req.result < 0 && req.result != UV_ENOENT) {
+                throw UVException(static_cast<int>(req.result), "rmdir", req.path);
+            }
+        });
+}
+
+// list the directory and call `on_entry` for each of its entries on the loop thread
+void scandir_async(std::shared_ptr<RequestGroup> group, std::string path, bool ignore_missing,
+                   util::UniqueFunction<void(const std::string&, const uv_dirent_t&)> on_entry)
+{
+    submit_request(
+        std::move(group), std::move(path), "scandir",
+        [](uv_loop_t* loop, uv_fs_t* req, const char* path, uv_fs_cb cb) {
+            return uv_fs_scandir(loop, req, path, 0, cb);
+        },
+        [ignore_missing, on_entry = std::move(on_entry)](AsyncFileSystemRequest& req) {
+            if (req.result < 0) {
+                if (ignore_missing && req.result == UV_ENOENT) {
+                    return;
+                }
+                throw UVException(static_cast<int>(req.result), "scandir", req.path);
+            }
+            uv_dirent_t entry;
+            while (uv_fs_scandir_next(&req, &entry) != UV_EOF) {
+                on_entry(req.path + '/' + entry.name, entry);
+            }
+        });
+}
+
+// unlink all entries of the directory in parallel and remove it once they are all gone
+void remove_directory_in_group(std::shared_ptr<RequestGroup> group, std::string path)
+{
+    auto entries = std::make_shared<RequestGroup>([group, path](std::exception_ptr error) mutable {
+        if (error) {
+            group->fail(std::move(error));
+        }
+        else {
+            rmdir_async(std::move(group), std::move(path));
+        }
+    });
+    // the scandir request keeps the group alive until all of the unlink requests were issued
+    std::weak_ptr<RequestGroup> weak_entries = entries;
+    scandir_async(std::move(entries), std::move(path), true,
+                  [weak_entries](const std::string& entry_path, const uv_dirent_t&) {
+                      unlink_async(weak_entries.lock(), entry_path);
+                  });
+}
+
+struct BackgroundWork : uv_work_t {
+    util::UniqueFunction<void()> work;
+};
+
+} // anonymous namespace
+
 void JsPlatformHelpers::set_default_realm_file_directory(std::string dir)
 {
     s_default_realm_directory = dir;
@@ -209,6 +379,53 @@ void JsPlatformHelpers::remove_file(const std::string& path)
     }
 }
 
+void JsPlatformHelpers::remove_realm_files_from_directory_async(const std::string& dir_path,
+                                                                CompletionCallback callback)
+{
+    auto group = std::make_shared<RequestGroup>(std::move(callback));
+    std::weak_ptr<RequestGroup> weak_group = group;
+    scandir_async(std::move(group), dir_path, false, [weak_group](const std::string& path, const uv_dirent_t& entry) {
+        if (entry.type == UV_DIRENT_DIR) {
+            if (ends_with(path, ".realm.management")) {
+                remove_directory_in_group(weak_group.lock(), path);
+            }
+        }
+        else if (ends_with(path, ".realm") || ends_with(path, ".realm.note") || ends_with(path, ".realm.lock") ||
+                 ends_with(path, ".realm.fresh.lock") || ends_with(path, ".realm.log") ||
+                 ends_with(path, ".realm.log_a") || ends_with(path, ".realm.log_b")) {
+            unlink_async(weak_group.lock(), path);
+        }
+    });
+}
+
+void JsPlatformHelpers::remove_directory_async(const std::string& path, CompletionCallback callback)
+{
+    remove_directory_in_group(std::make_shared<RequestGroup>(std::move(callback)), path);
+}
+
+void JsPlatformHelpers::remove_file_async(const std::string& path, CompletionCallback callback)
+{
+    unlink_async(std::make_shared<RequestGroup>(std::move(callback)), path);
+}
+
+void JsPlatformHelpers::run_in_background(util::UniqueFunction<void()> work)
+{
+    auto req = std::make_unique<BackgroundWork>();
+    req->work = std::move(work);
+    int err = uv_queue_work(
+        uv_default_loop(), req.get(),
+        [](uv_work_t* work_req) {
+            static_cast<BackgroundWork*>(work_req)->work();
+        },
+        [](uv_work_t* work_req, int) {
+            delete static_cast<BackgroundWork*>(work_req);
+        });
+    if (err < 0) {
+        throw UVException(static_cast<uv_errno_t>(err));
+    }
+    req.release();
+}
+
 void JsPlatformHelpers::exclude_from_icloud_backup(const std::string&, bool)
 {
     // no-op
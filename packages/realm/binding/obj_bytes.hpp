@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/obj.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace realm {
+
+/**
+ * Reads ranges of the bytes of `data` and `string` properties. The value is read in place from the Realm file,
+ * such that only the requested range is copied into JS. Strings are read as their UTF-8 bytes and nulls as empty.
+ */
+class JsObjBytes {
+public:
+    static size_t byte_length(const Obj& obj, ColKey column)
+    {
+        return value_of(obj, column).size();
+    }
+
+    static BinaryData read(const Obj& obj, ColKey column, size_t offset, size_t length)
+    {
+        const BinaryData value = value_of(obj, column);
+        if (offset >= value.size())
+            return BinaryData("", 0);
+        return BinaryData(value.data() + offset, std::min(length, value.size() - offset));
+    }
+
+private:
+    static BinaryData value_of(const Obj& obj, ColKey column)
+    {
+        check_column(column);
+        if (column.get_type() == col_type_String) {
+            const StringData value = obj.get<StringData>(column);
+            return value.is_null() ? BinaryData("", 0) : BinaryData(value.data(), value.size());
+        }
+        const BinaryData value = obj.get<BinaryData>(column);
+        return value.is_null() ? BinaryData("", 0) : value;
+    }
+
+    static void check_column(ColKey column)
+    {
+        const ColumnType type = column.get_type();
+        if (column.is_collection() || (type != col_type_String && type != col_type_Binary))
+            throw std::invalid_argument("Expected a 'data' or 'string' property");
+    }
+
+    friend class BytesWriter;
+};
+
+class BytesWriter;
+using SharedBytesWriter = std::shared_ptr<BytesWriter>;
+
+/**
+ * Collects the chunks of a `data` or `string` value outside of JS, to set it without the JS side ever holding the
+ * whole value. Core sets values in one piece, so the value is materialized here once, in native memory.
+ */
+class BytesWriter {
+public:
+    static SharedBytesWriter make()
+    {
+        return std::make_shared<BytesWriter>();
+    }
+
+    void append(BinaryData chunk)
+    {
+        m_buffer.append(chunk.data(), chunk.size());
+    }
+
+    void append_string(const std::string& chunk)
+    {
+        m_buffer.append(chunk);
+    }
+
+    size_t size() const
+    {
+        return m_buffer.size();
+    }
+
+    // Sets the value of the property to the chunks appended so far and releases them.
+    // Must be called in a write transaction.
+    void commit(Obj& obj, ColKey column)
+    {
+        JsObjBytes::check_column(column);
+        if (column.get_type() == col_type_String) {
+            obj.set(column, StringData(m_buffer.data(), m_buffer.size()));
+        }
+        else {
+            obj.set(column, BinaryData(m_buffer.data(), m_buffer.size()));
+        }
+        std::string().swap(m_buffer);
+    }
+
+private:
+    std::string m_buffer;
+};
+
+} // namespace realm
@@ -18,6 +18,9 @@
 
 #pragma once
 
+#include <realm/util/functional.hpp>
+
+#include <exception>
 #include <string>
 
 namespace realm {
@@ -28,6 +31,9 @@ namespace realm {
 
 class JsPlatformHelpers {
 public:
+    // called once an asynchronous operation completed, with its error if any. may be called from any thread
+    using CompletionCallback = util::UniqueFunction<void(std::exception_ptr)>;
+
     // set the directory where realm files should be stored
     static void set_default_realm_file_directory(std::string dir);
 
@@ -49,6 +55,16 @@ public:
     // remove directory at the given path
     static void remove_directory(const std::string& path);
 
+    // asynchronous variants of the above, which remove the files off the JS thread, in parallel where possible
+    static void remove_realm_files_from_directory_async(const std::string& directory, CompletionCallback callback);
+    static void remove_file_async(const std::string& path, CompletionCallback callback);
+    static void remove_directory_async(const std::string& path, CompletionCallback callback);
+
+    // run `work` off the JS thread: on the libuv threadpool on Node, a global dispatch queue on Apple platforms and a
+    // shared pool of worker threads on Android.
+    // must be called from the JS thread, and `work` must not throw
+    static void run_in_background(util::UniqueFunction<void()> work);
+
     // the CPU architecture
     static std::string get_cpu_arch();
 
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "trace_events.hpp"
+
+#include <realm/db.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/util/file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace realm {
+
+struct LatencyHistogramSnapshot {
+    size_t count = 0;
+    double total_ms = 0;
+    double max_ms = 0;
+    // Bucket i counts samples which took between 2^i and 2^(i+1) nanoseconds, like the binding call stats.
+    std::vector<size_t> buckets;
+};
+
+struct RealmMetricsSnapshot {
+    LatencyHistogramSnapshot write_lock_wait;
+    LatencyHistogramSnapshot commit;
+    size_t commit_bytes_total = 0;
+    size_t commit_bytes_last = 0;
+    size_t commit_bytes_max = 0;
+    std::map<std::string, LatencyHistogramSnapshot> notification_callbacks;
+    size_t version = 0;
+    size_t number_of_versions = 0;
+    size_t file_size = 0;
+};
+
+class LatencyHistogram {
+public:
+    static constexpr size_t num_buckets = 40;
+
+    void record(std::chrono::steady_clock::duration elapsed) noexcept
+    {
+        const auto ns = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        const size_t bucket = ns == 0 ? 0 : std::min<size_t>(std::bit_width(ns) - 1, num_buckets - 1);
+        ++m_count;
+        m_total_ns += ns;
+        m_max_ns = std::max(m_max_ns, ns);
+        ++m_buckets[bucket];
+    }
+
+    LatencyHistogramSnapshot snapshot() const
+    {
+        return {
+            size_t(m_count),
+            double(m_total_ns) / 1e6,
+            double(m_max_ns) / 1e6,
+            std::vector<size_t>(m_buckets.begin(), m_buckets.end()),
+        };
+    }
+
+private:
+    uint64_t m_count = 0;
+    uint64_t m_total_ns = 0;
+    uint64_t m_max_ns = 0;
+    std::array<uint64_t, num_buckets> m_buckets{};
+};
+
+class RealmMetrics;
+using SharedRealmMetrics = std::shared_ptr<RealmMetrics>;
+
+/**
+ * Timing and size metrics for a single Realm instance, recorded around the calls the SDK makes into the Realm.
+ * Recording is a couple of clock reads and additions, so it is always on.
+ * Like the Realm itself, this is confined to the thread it was created on and does no synchronization.
+ */
+class RealmMetrics {
+public:
+    static SharedRealmMetrics make()
+    {
+        return std::make_shared<RealmMetrics>();
+    }
+
+    // Beginning a write transaction blocks until the write lock is acquired, which is what dominates the time spent.
+    void begin_transaction(const SharedRealm& realm)
+    {
+        const auto start = clock::now();
+        realm->begin_transaction();
+        const auto elapsed = clock::now() - start;
+        m_write_lock_wait.record(elapsed);
+        if (js::trace::TraceRecorder::is_enabled())
+            js::trace::TraceRecorder::get().record("write", "beginTransaction", start, elapsed);
+    }
+
+    void commit_transaction(const SharedRealm& realm)
+    {
+        // The Group of a Realm in a write transaction is always the write Transaction. Without one, reading the Group
+        // would begin a read transaction, so leave it to commit_transaction() to throw.
+        const size_t commit_size =
+            realm->is_in_transaction() ? static_cast<Transaction&>(realm->read_group()).get_commit_size() : 0;
+        const auto start = clock::now();
+        realm->commit_transaction();
+        const auto elapsed = clock::now() - start;
+        m_commit.record(elapsed);
+        if (js::trace::TraceRecorder::is_enabled())
+            js::trace::TraceRecorder::get().record("write", "commitTransaction", start, elapsed,
+                                                   std::to_string(commit_size) + " bytes");
+        m_commit_bytes_total += commit_size;
+        m_commit_bytes_last = commit_size;
+        m_commit_bytes_max = std::max(m_commit_bytes_max, commit_size);
+    }
+
+    // Notification callbacks are never nested, so a single start time is enough.
+    void will_invoke_callback()
+    {
+        m_callback_start = clock::now();
+    }
+
+    void did_invoke_callback(const std::string& collection)
+    {
+        const auto elapsed = clock::now() - m_callback_start;
+        m_notification_callbacks[collection].record(elapsed);
+        if (js::trace::TraceRecorder::is_enabled())
+            js::trace::TraceRecorder::get().record("notification", "callback", m_callback_start, elapsed, collection);
+    }
+
+    RealmMetricsSnapshot snapshot(const SharedRealm& realm) const
+    {
+        RealmMetricsSnapshot out;
+        out.write_lock_wait = m_write_lock_wait.snapshot();
+        out.commit = m_commit.snapshot();
+        out.commit_bytes_total = m_commit_bytes_total;
+        out.commit_bytes_last = m_commit_bytes_last;
+        out.commit_bytes_max = m_commit_bytes_max;
+        for (const auto& [collection, histogram] : m_notification_callbacks) {
+            out.notification_callbacks.emplace(collection, histogram.snapshot());
+        }
+        if (!realm->is_closed()) {
+            if (auto version = realm->current_transaction_version())
+                out.version = size_t(version->version);
+            out.number_of_versions = size_t(realm->get_number_of_versions());
+            if (!realm->config().in_memory)
+                out.file_size = size_t(util::File::get_size_static(realm->config().path));
+        }
+        return out;
+    }
+
+    void reset()
+    {
+        *this = RealmMetrics();
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    LatencyHistogram m_write_lock_wait;
+    LatencyHistogram m_commit;
+    size_t m_commit_bytes_total = 0;
+    size_t m_commit_bytes_last = 0;
+    size_t m_commit_bytes_max = 0;
+    std::map<std::string, LatencyHistogram> m_notification_callbacks;
+    clock::time_point m_callback_start;
+};
+
+} // namespace realm
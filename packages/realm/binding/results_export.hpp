@@ -0,0 +1,914 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "json_string.hpp"
+#include "platform.hpp"
+
+#include <realm/decimal128.hpp>
+#include <realm/obj.hpp>
+#include <realm/object_id.hpp>
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
+#include <realm/table.hpp>
+#include <realm/timestamp.hpp>
+#include <realm/uuid.hpp>
+#include <realm/util/functional.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace realm {
+namespace js {
+namespace exporter {
+
+enum class ExportFormat { ndjson, csv, arrow };
+
+inline ExportFormat parse_format(std::string_view format)
+{
+    if (format == "ndjson")
+        return ExportFormat::ndjson;
+    if (format == "csv")
+        return ExportFormat::csv;
+    if (format == "arrow")
+        return ExportFormat::arrow;
+    throw std::invalid_argument("Unsupported export format '" + std::string(format) + "'");
+}
+
+struct ExportColumn {
+    std::string header;
+    ColKey key;
+    DataType type;
+};
+
+class ExportFile {
+public:
+    explicit ExportFile(const std::string& path)
+        : m_file(std::fopen(path.c_str(), "wb"))
+    {
+        if (!m_file)
+            throw std::runtime_error("Failed to open '" + path + "' for writing");
+    }
+
+    ~ExportFile()
+    {
+        if (m_file)
+            std::fclose(m_file);
+    }
+
+    ExportFile(const ExportFile&) = delete;
+    ExportFile& operator=(const ExportFile&) = delete;
+
+    void write(const void* data, size_t size)
+    {
+        if (size != 0 && std::fwrite(data, 1, size, m_file) != size)
+            throw std::runtime_error("Failed to write the export file");
+    }
+
+    void write(std::string_view data)
+    {
+        write(data.data(), data.size());
+    }
+
+    void close()
+    {
+        const bool failed = std::fclose(m_file) != 0;
+        m_file = nullptr;
+        if (failed)
+            throw std::runtime_error("Failed to close the export file");
+    }
+
+private:
+    std::FILE* m_file;
+};
+
+// ISO 8601 in UTC with millisecond precision, also for times before 1970.
+inline void append_timestamp(std::string& out, Timestamp timestamp)
+{
+    int64_t seconds = timestamp.get_seconds();
+    int32_t ms = timestamp.get_nanoseconds() / 1000000;
+    if (ms < 0) {
+        seconds -= 1;
+        ms += 1000;
+    }
+    const auto time = std::time_t(seconds);
+    std::tm tm{};
+#ifdef _WIN32
+    gmtime_s(&tm, &time);
+#else
+    gmtime_r(&time, &tm);
+#endif
+    char buffer[40];
+    const auto length = std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%S", &tm);
+    std::snprintf(buffer + length, sizeof(buffer) - length, ".%03dZ", int(ms));
+    out += buffer;
+}
+
+inline void append_base64(std::string& out, BinaryData data)
+{
+    static constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+    size_t i = 0;
+    for (; i + 2 < data.size(); i += 3) {
+        const uint32_t triple = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+        out += alphabet[(triple >> 18) & 0x3f];
+        out += alphabet[(triple >> 12) & 0x3f];
+        out += alphabet[(triple >> 6) & 0x3f];
+        out += alphabet[triple & 0x3f];
+    }
+    if (i + 1 == data.size()) {
+        const uint32_t triple = bytes[i] << 16;
+        out += alphabet[(triple >> 18) & 0x3f];
+        out += alphabet[(triple >> 12) & 0x3f];
+        out += "==";
+    }
+    else if (i + 2 == data.size()) {
+        const uint32_t triple = (bytes[i] << 16) | (bytes[i + 1] << 8);
+        out += alphabet[(triple >> 18) & 0x3f];
+        out += alphabet[(triple >> 12) & 0x3f];
+        out += alphabet[(triple >> 6) & 0x3f];
+        out += '=';
+    }
+}
+
+// Uses the shorter of the two precisions which reads back as the same value,
+// i.e. "0.1" rather than "0.10000000000000001".
+template <typename T>
+inline void append_number(std::string& out, T value, int short_precision, int full_precision)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.*g", short_precision, double(value));
+    if (T(std::strtod(buffer, nullptr)) != value)
+        std::snprintf(buffer, sizeof(buffer), "%.*g", full_precision, double(value));
+    out += buffer;
+}
+
+/*
+ * Appends the textual representation of a value, shared by the NDJSON and CSV writers.
+ * Returns false for null values and values which have no textual representation, such as links and collections.
+ */
+inline bool append_text(std::string& out, const Mixed& value, bool& is_string)
+{
+    is_string = false;
+    if (value.is_null())
+        return false;
+    switch (value.get_type()) {
+        case type_Int:
+            out += std::to_string(value.get_int());
+            return true;
+        case type_Bool:
+            out += value.get_bool() ? "true" : "false";
+            return true;
+        case type_Float:
+            if (!std::isfinite(value.get_float()))
+                return false;
+            append_number(out, value.get_float(), 6, 9);
+            return true;
+        case type_Double:
+            if (!std::isfinite(value.get_double()))
+                return false;
+            append_number(out, value.get_double(), 15, 17);
+            return true;
+        case type_String:
+            is_string = true;
+            out += std::string_view(value.get_string());
+            return true;
+        case type_Binary:
+            is_string = true;
+            append_base64(out, value.get_binary());
+            return true;
+        case type_Timestamp:
+            is_string = true;
+            append_timestamp(out, value.get_timestamp());
+            return true;
+        case type_ObjectId:
+            is_string = true;
+            out += value.get_object_id().to_string();
+            return true;
+        case type_UUID:
+            is_string = true;
+            out += value.get_uuid().to_string();
+            return true;
+        case type_Decimal:
+            is_string = true;
+            out += value.get_decimal().to_string();
+            return true;
+        default:
+            return false;
+    }
+}
+
+/*
+ * Appends a value of a mixed property as Extended JSON, which keeps its type when imported again.
+ * Returns false for null values and values which can't be exported, such as links and collections.
+ */
+inline bool append_ejson(std::string& out, const Mixed& value)
+{
+    if (value.is_null())
+        return false;
+    switch (value.get_type()) {
+        case type_Bool:
+            out += value.get_bool() ? "true" : "false";
+            return true;
+        case type_String:
+            append_json_string(out, std::string_view(value.get_string()));
+            return true;
+        case type_Int:
+            out += "{\"$numberLong\":\"" + std::to_string(value.get_int()) + "\"}";
+            return true;
+        case type_Float:
+        case type_Double: {
+            const double number = value.get_type() == type_Float ? double(value.get_float()) : value.get_double();
+            out += "{\"$numberDouble\":\"";
+            if (std::isnan(number))
+                out += "NaN";
+            else if (std::isinf(number))
+                out += number < 0 ? "-Infinity" : "Infinity";
+            else
+                append_number(out, number, 15, 17);
+            out += "\"}";
+            return true;
+        }
+        case type_Binary:
+            out += "{\"$binary\":{\"base64\":\"";
+            append_base64(out, value.get_binary());
+            out += "\",\"subType\":\"00\"}}";
+            return true;
+        case type_Timestamp: {
+            const auto timestamp = value.get_timestamp();
+            const int64_t ms = timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1000000;
+            out += "{\"$date\":{\"$numberLong\":\"" + std::to_string(ms) + "\"}}";
+            return true;
+        }
+        case type_ObjectId:
+            out += "{\"$oid\":\"" + value.get_object_id().to_string() + "\"}";
+            return true;
+        case type_UUID:
+            out += "{\"$uuid\":\"" + value.get_uuid().to_string() + "\"}";
+            return true;
+        case type_Decimal:
+            out += "{\"$numberDecimal\":\"" + value.get_decimal().to_string() + "\"}";
+            return true;
+        default:
+            return false;
+    }
+}
+
+class RowWriter {
+public:
+    virtual ~RowWriter() = default;
+    virtual void write_row(const Obj& obj) = 0;
+    // Called once all rows are written, and once every batch of rows.
+    virtual void flush() = 0;
+};
+
+class NdjsonWriter final : public RowWriter {
+public:
+    NdjsonWriter(ExportFile& file, const std::vector<ExportColumn>& columns)
+        : m_file(file)
+        , m_columns(columns)
+    {
+    }
+
+    void write_row(const Obj& obj) override
+    {
+        m_buffer += '{';
+        bool first = true;
+        for (const auto& column : m_columns) {
+            if (!first)
+                m_buffer += ',';
+            first = false;
+            append_json_string(m_buffer, column.header);
+            m_buffer += ':';
+            m_value.clear();
+            bool is_string;
+            if (column.type == type_Mixed) {
+                if (!append_ejson(m_buffer, obj.get_any(column.key)))
+                    m_buffer += "null";
+            }
+            else if (!append_text(m_value, obj.get_any(column.key), is_string))
+                m_buffer += "null";
+            else if (is_string)
+                append_json_string(m_buffer, m_value);
+            else
+                m_buffer += m_value;
+        }
+        m_buffer += "}\n";
+    }
+
+    void flush() override
+    {
+        m_file.write(m_buffer);
+        m_buffer.clear();
+    }
+
+private:
+    ExportFile& m_file;
+    const std::vector<ExportColumn>& m_columns;
+    std::string m_buffer;
+    std::string m_value;
+};
+
+// RFC 4180, with a header row. Nulls are written as empty fields and empty strings as quoted empty fields.
+// Values of mixed properties are written as Extended JSON.
+class CsvWriter final : public RowWriter {
+public:
+    CsvWriter(ExportFile& file, const std::vector<ExportColumn>& columns)
+        : m_file(file)
+        , m_columns(columns)
+    {
+        bool first = true;
+        for (const auto& column : m_columns) {
+            if (!first)
+                m_buffer += ',';
+            first = false;
+            append_field(column.header);
+        }
+        m_buffer += "\r\n";
+    }
+
+    void write_row(const Obj& obj) override
+    {
+        bool first = true;
+        for (const auto& column : m_columns) {
+            if (!first)
+                m_buffer += ',';
+            first = false;
+            m_value.clear();
+            bool is_string;
+            const auto value = obj.get_any(column.key);
+            if (column.type == type_Mixed ? append_ejson(m_value, value) : append_text(m_value, value, is_string))
+                append_field(m_value);
+        }
+        m_buffer += "\r\n";
+    }
+
+    void flush() override
+    {
+        m_file.write(m_buffer);
+        m_buffer.clear();
+    }
+
+private:
+    void append_field(std::string_view value)
+    {
+        if (!value.empty() && value.find_first_of(",\"\r\n") == std::string_view::npos) {
+            m_buffer += value;
+            return;
+        }
+        m_buffer += '"';
+        for (const char c : value) {
+            if (c == '"')
+                m_buffer += '"';
+            m_buffer += c;
+        }
+        m_buffer += '"';
+    }
+
+    ExportFile& m_file;
+    const std::vector<ExportColumn>& m_columns;
+    std::string m_buffer;
+    std::string m_value;
+};
+
+/*
+ * Just enough of a FlatBuffers builder to write the metadata of Arrow IPC messages.
+ * Unlike the official builder, this writes front to back: tables are written before their children,
+ * which are appended later and patched into the offset fields of the table.
+ */
+class FlatBufferBuilder {
+public:
+    // A field of a table, either an inline scalar or an offset to a child written by `write_child`.
+    struct Field {
+        uint16_t id;
+        std::vector<uint8_t> scalar;
+        std::function<size_t(FlatBufferBuilder&)> write_child;
+
+        template <typename T>
+        static Field of(uint16_t id, T value)
+        {
+            Field field{id, std::vector<uint8_t>(sizeof(T)), nullptr};
+            std::memcpy(field.scalar.data(), &value, sizeof(T));
+            return field;
+        }
+
+        static Field child(uint16_t id, std::function<size_t(FlatBufferBuilder&)> write_child)
+        {
+            return {id, {}, std::move(write_child)};
+        }
+    };
+
+    FlatBufferBuilder()
+    {
+        // Placeholder for the offset to the root table.
+        put<uint32_t>(0);
+    }
+
+    std::vector<uint8_t> finish(std::vector<Field> root)
+    {
+        patch(0, table(std::move(root)));
+        align(8);
+        return std::move(m_buffer);
+    }
+
+    size_t table(std::vector<Field> fields)
+    {
+        uint16_t slots = 0;
+        size_t max_align = 4;
+        for (const auto& field : fields) {
+            slots = std::max<uint16_t>(slots, field.id + 1);
+            max_align = std::max(max_align, field.write_child ? 4 : field.scalar.size());
+        }
+
+        // The vtable is written right before the table, which refers back to it.
+        align(2);
+        const size_t vtable = m_buffer.size();
+        const size_t vtable_size = 4 + 2 * size_t(slots);
+        size_t table = align_up(vtable + vtable_size, max_align);
+
+        std::vector<uint16_t> offsets(slots, 0);
+        std::vector<size_t> positions(fields.size());
+        size_t end = table + 4;
+        for (size_t i = 0; i < fields.size(); i++) {
+            const size_t size = fields[i].write_child ? 4 : fields[i].scalar.size();
+            positions[i] = align_up(end, size);
+            offsets[fields[i].id] = uint16_t(positions[i] - table);
+            end = positions[i] + size;
+        }
+
+        put<uint16_t>(uint16_t(vtable_size));
+        put<uint16_t>(uint16_t(end - table));
+        for (const auto offset : offsets) {
+            put<uint16_t>(offset);
+        }
+        m_buffer.resize(end, 0);
+        const int32_t soffset = int32_t(table - vtable);
+        std::memcpy(&m_buffer[table], &soffset, 4);
+        for (size_t i = 0; i < fields.size(); i++) {
+            if (!fields[i].write_child)
+                std::memcpy(&m_buffer[positions[i]], fields[i].scalar.data(), fields[i].scalar.size());
+        }
+        for (size_t i = 0; i < fields.size(); i++) {
+            if (fields[i].write_child)
+                patch(positions[i], fields[i].write_child(*this));
+        }
+        return table;
+    }
+
+    size_t string(std::string_view value)
+    {
+        const size_t position = put<uint32_t>(uint32_t(value.size()));
+        m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+        m_buffer.push_back(0);
+        return position;
+    }
+
+    size_t tables(size_t count, const std::function<size_t(FlatBufferBuilder&, size_t)>& write_table)
+    {
+        const size_t position = put<uint32_t>(uint32_t(count));
+        m_buffer.resize(m_buffer.size() + 4 * count, 0);
+        for (size_t i = 0; i < count; i++) {
+            patch(position + 4 + 4 * i, write_table(*this, i));
+        }
+        return position;
+    }
+
+    // A vector of structs made of two int64s, such as Arrow's FieldNode and Buffer.
+    size_t structs(const std::vector<std::pair<int64_t, int64_t>>& values)
+    {
+        // The elements must be 8 byte aligned, and are preceded by the 4 byte length.
+        while ((m_buffer.size() + 4) % 8 != 0)
+            m_buffer.push_back(0);
+        const size_t position = put<uint32_t>(uint32_t(values.size()));
+        for (const auto& [first, second] : values) {
+            put<int64_t>(first);
+            put<int64_t>(second);
+        }
+        return position;
+    }
+
+private:
+    static size_t align_up(size_t position, size_t alignment)
+    {
+        return (position + alignment - 1) / alignment * alignment;
+    }
+
+    void align(size_t alignment)
+    {
+        m_buffer.resize(align_up(m_buffer.size(), alignment), 0);
+    }
+
+    template <typename T>
+    size_t put(T value)
+    {
+        align(sizeof(T));
+        const size_t position = m_buffer.size();
+        m_buffer.resize(position + sizeof(T));
+        std::memcpy(&m_buffer[position], &value, sizeof(T));
+        return position;
+    }
+
+    // Offsets are unsigned and relative to where they're stored, which is why children are written after parents.
+    void patch(size_t position, size_t target)
+    {
+        const uint32_t offset = uint32_t(target - position);
+        std::memcpy(&m_buffer[position], &offset, 4);
+    }
+
+    std::vector<uint8_t> m_buffer;
+};
+
+/*
+ * Writes an Arrow IPC stream: a schema message followed by a record batch message per batch of rows, each holding
+ * the rows column by column. Only the rows of the current batch are kept in memory.
+ * See https://arrow.apache.org/docs/format/Columnar.html#serialization-and-interprocess-communication-ipc
+ */
+class ArrowWriter final : public RowWriter {
+public:
+    ArrowWriter(ExportFile& file, const std::vector<ExportColumn>& columns)
+        : m_file(file)
+        , m_columns(columns)
+        , m_builders(columns.size())
+    {
+        for (size_t i = 0; i < columns.size(); i++) {
+            m_builders[i].kind = kind_for(columns[i].type);
+        }
+        write_schema();
+    }
+
+    void write_row(const Obj& obj) override
+    {
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            m_builders[i].append(obj.get_any(m_columns[i].key), m_text);
+        }
+        m_rows++;
+    }
+
+    void flush() override
+    {
+        if (m_rows != 0)
+            write_record_batch();
+    }
+
+    void finish()
+    {
+        flush();
+        // The end-of-stream marker: a continuation token and a zero metadata length.
+        const uint32_t eos[] = {continuation, 0};
+        m_file.write(eos, sizeof(eos));
+    }
+
+private:
+    // Arrow's enums and union type ids, from Schema.fbs and Message.fbs.
+    enum : uint8_t { type_int = 2, type_floating_point = 3, type_binary = 4, type_utf8 = 5, type_bool = 6 };
+    enum : uint8_t { type_timestamp = 10 };
+    enum : uint8_t { header_schema = 1, header_record_batch = 3 };
+    static constexpr int16_t metadata_version_v5 = 4;
+    static constexpr uint32_t continuation = 0xFFFFFFFF;
+
+    enum class Kind { int64, boolean, float32, float64, timestamp, utf8, binary };
+
+    static Kind kind_for(DataType type)
+    {
+        switch (type) {
+            case type_Int:
+                return Kind::int64;
+            case type_Bool:
+                return Kind::boolean;
+            case type_Float:
+                return Kind::float32;
+            case type_Double:
+                return Kind::float64;
+            case type_Timestamp:
+                return Kind::timestamp;
+            case type_Binary:
+                return Kind::binary;
+            default:
+                // Strings, and the types without an Arrow equivalent, such as ObjectId, are written as text.
+                return Kind::utf8;
+        }
+    }
+
+    struct ColumnBuilder {
+        Kind kind;
+        size_t length = 0;
+        size_t null_count = 0;
+        std::vector<uint8_t> validity;
+        std::vector<uint8_t> values;
+        std::vector<int32_t> offsets{0};
+
+        template <typename T>
+        void append_fixed(T value)
+        {
+            const size_t position = values.size();
+            values.resize(position + sizeof(T));
+            std::memcpy(&values[position], &value, sizeof(T));
+        }
+
+        void append_bytes(const char* data, size_t size)
+        {
+            values.insert(values.end(), data, data + size);
+            offsets.push_back(int32_t(values.size()));
+        }
+
+        void append(const Mixed& value, std::string& text)
+        {
+            if (length % 8 == 0) {
+                validity.push_back(0);
+                if (kind == Kind::boolean)
+                    values.push_back(0);
+            }
+            bool valid = !value.is_null();
+            switch (kind) {
+                case Kind::int64:
+                    append_fixed<int64_t>(valid ? value.get_int() : 0);
+                    break;
+                case Kind::boolean:
+                    if (valid && value.get_bool())
+                        values.back() |= uint8_t(1 << (length % 8));
+                    break;
+                case Kind::float32:
+                    append_fixed<float>(valid ? value.get_float() : 0);
+                    break;
+                case Kind::float64:
+                    append_fixed<double>(valid ? value.get_double() : 0);
+                    break;
+                case Kind::timestamp: {
+                    int64_t ms = 0;
+                    if (valid) {
+                        const auto timestamp = value.get_timestamp();
+                        ms = timestamp.get_seconds() * 1000 + timestamp.get_nanoseconds() / 1000000;
+                    }
+                    append_fixed<int64_t>(ms);
+                    break;
+                }
+                case Kind::binary: {
+                    const auto binary = valid ? value.get_binary() : BinaryData();
+                    append_bytes(binary.data(), binary.size());
+                    break;
+                }
+                case Kind::utf8: {
+                    text.clear();
+                    bool is_string;
+                    valid = valid && append_text(text, value, is_string);
+                    append_bytes(text.data(), valid ? text.size() : 0);
+                    break;
+                }
+            }
+            if (valid)
+                validity.back() |= uint8_t(1 << (length % 8));
+            else
+                null_count++;
+            length++;
+        }
+
+        void clear()
+        {
+            length = 0;
+            null_count = 0;
+            validity.clear();
+            values.clear();
+            offsets.assign(1, 0);
+        }
+    };
+
+    static std::vector<FlatBufferBuilder::Field> type_fields(Kind kind)
+    {
+        using Field = FlatBufferBuilder::Field;
+        // Field.type_type is field 2 and Field.type is field 3.
+        auto type = [](uint8_t type_id, std::vector<Field> fields) {
+            return std::vector<Field>{
+                Field::of<uint8_t>(2, type_id),
+                Field::child(3,
+                             [fields = std::move(fields)](FlatBufferBuilder& builder) {
+                                 return builder.table(fields);
+                             }),
+            };
+        };
+        switch (kind) {
+            case Kind::int64:
+                return type(type_int, {Field::of<int32_t>(0, 64), Field::of<uint8_t>(1, 1)});
+            case Kind::boolean:
+                return type(type_bool, {});
+            case Kind::float32:
+                return type(type_floating_point, {Field::of<int16_t>(0, 1)});
+            case Kind::float64:
+                return type(type_floating_point, {Field::of<int16_t>(0, 2)});
+            case Kind::timestamp:
+                return type(type_timestamp, {Field::of<int16_t>(0, 1), Field::child(1, [](FlatBufferBuilder& builder) {
+                                                 return builder.string("UTC");
+                                             })});
+            case Kind::binary:
+                return type(type_binary, {});
+            case Kind::utf8:
+                return type(type_utf8, {});
+        }
+        REALM_UNREACHABLE();
+    }
+
+    void write_message(uint8_t header_type, std::vector<FlatBufferBuilder::Field> header,
+                       const std::vector<uint8_t>& body)
+    {
+        using Field = FlatBufferBuilder::Field;
+        FlatBufferBuilder builder;
+        const auto metadata = builder.finish({
+            Field::of<int16_t>(0, metadata_version_v5),
+            Field::of<uint8_t>(1, header_type),
+            Field::child(2,
+                         [header = std::move(header)](FlatBufferBuilder& builder) {
+                             return builder.table(header);
+                         }),
+            Field::of<int64_t>(3, int64_t(body.size())),
+        });
+        const uint32_t prefix[] = {continuation, uint32_t(metadata.size())};
+        m_file.write(prefix, sizeof(prefix));
+        m_file.write(metadata.data(), metadata.size());
+        m_file.write(body.data(), body.size());
+    }
+
+    void write_schema()
+    {
+        using Field = FlatBufferBuilder::Field;
+        write_message(header_schema,
+                      {
+                          // Schema.fields
+                          Field::child(1,
+                                       [this](FlatBufferBuilder& builder) {
+                                           return builder.tables(m_columns.size(), [this](FlatBufferBuilder& builder,
+                                                                                          size_t i) {
+                                               auto fields = type_fields(m_builders[i].kind);
+                                               fields.push_back(Field::child(0, [this, i](FlatBufferBuilder& builder) {
+                                                   return builder.string(m_columns[i].header);
+                                               }));
+                                               fields.push_back(Field::of<uint8_t>(1, 1)); // nullable
+                                               // Field.children is required, even if empty.
+                                               fields.push_back(Field::child(5, [](FlatBufferBuilder& builder) {
+                                                   return builder.structs({});
+                                               }));
+                                               return builder.table(std::move(fields));
+                                           });
+                                       }),
+                      },
+                      {});
+    }
+
+    void write_record_batch()
+    {
+        using Field = FlatBufferBuilder::Field;
+        std::vector<std::pair<int64_t, int64_t>> nodes;
+        std::vector<std::pair<int64_t, int64_t>> buffers;
+        std::vector<uint8_t> body;
+        auto add_buffer = [&](const void* data, size_t size) {
+            buffers.emplace_back(int64_t(body.size()), int64_t(size));
+            const auto bytes = static_cast<const uint8_t*>(data);
+            body.insert(body.end(), bytes, bytes + size);
+            body.resize((body.size() + 7) / 8 * 8, 0);
+        };
+        for (auto& column : m_builders) {
+            nodes.emplace_back(int64_t(column.length), int64_t(column.null_count));
+            add_buffer(column.validity.data(), column.validity.size());
+            if (column.kind == Kind::utf8 || column.kind == Kind::binary)
+                add_buffer(column.offsets.data(), column.offsets.size() * sizeof(int32_t));
+            add_buffer(column.values.data(), column.values.size());
+        }
+        write_message(header_record_batch,
+                      {
+                          Field::of<int64_t>(0, int64_t(m_rows)),
+                          Field::child(1,
+                                       [&nodes](FlatBufferBuilder& builder) {
+                                           return builder.structs(nodes);
+                                       }),
+                          Field::child(2,
+                                       [&buffers](FlatBufferBuilder& builder) {
+                                           return builder.structs(buffers);
+                                       }),
+                      },
+                      body);
+        for (auto& column : m_builders) {
+            column.clear();
+        }
+        m_rows = 0;
+    }
+
+    ExportFile& m_file;
+    const std::vector<ExportColumn>& m_columns;
+    std::vector<ColumnBuilder> m_builders;
+    size_t m_rows = 0;
+    std::string m_text;
+};
+
+} // namespace exporter
+} // namespace js
+
+class JsResultsExporter {
+public:
+    using ProgressCallback = util::UniqueFunction<void(size_t)>;
+    using CompletionCallback = util::UniqueFunction<void(size_t, std::exception_ptr)>;
+
+    /**
+     * Writes the objects of `results`, as of the version the Realm is currently at, to a file on a background thread.
+     * `on_progress`, if any, is called with the number of rows written after every batch and `on_complete` once done.
+     * Only the last argument can be an async callback, so `on_progress` is an off-thread callback, which the binding
+     * dispatches to the JS thread.
+     */
+    static void export_to(const SharedRealm& realm, Results& results, const std::string& path,
+                          const std::string& format, const std::vector<std::string>& column_names,
+                          const std::vector<std::string>& headers, size_t batch_size, ProgressCallback on_progress,
+                          CompletionCallback on_complete)
+    {
+        using namespace js::exporter;
+        const auto export_format = parse_format(format);
+        auto table = results.get_table();
+        if (!table)
+            throw std::invalid_argument("Only collections of objects can be exported");
+        std::vector<ExportColumn> columns;
+        for (size_t i = 0; i < column_names.size(); i++) {
+            const auto key = table->get_column_key(column_names[i]);
+            if (!key)
+                throw std::invalid_argument("Unknown property '" + column_names[i] + "'");
+            if (key.is_collection() || key.get_type() == col_type_Link)
+                throw std::invalid_argument("Property '" + headers[i] +
+                                            "' can't be exported, only properties of primitive types can");
+            columns.push_back({headers[i], key, DataType(key.get_type())});
+        }
+
+        // The frozen Realm and Results can be used from any thread, and keep the version alive until exported.
+        auto frozen_realm = realm->freeze();
+        auto frozen_results = results.freeze(frozen_realm);
+
+        JsPlatformHelpers::run_in_background([frozen_realm = std::move(frozen_realm),
+                                              frozen_results = std::move(frozen_results), columns = std::move(columns),
+                                              path, export_format, batch_size = std::max<size_t>(batch_size, 1),
+                                              on_progress = std::move(on_progress),
+                                              on_complete = std::move(on_complete)]() mutable {
+            size_t rows = 0;
+            try {
+                ExportFile file(path);
+                std::unique_ptr<RowWriter> writer;
+                ArrowWriter* arrow = nullptr;
+                if (export_format == ExportFormat::ndjson) {
+                    writer = std::make_unique<NdjsonWriter>(file, columns);
+                }
+                else if (export_format == ExportFormat::csv) {
+                    writer = std::make_unique<CsvWriter>(file, columns);
+                }
+                else {
+                    auto arrow_writer = std::make_unique<ArrowWriter>(file, columns);
+                    arrow = arrow_writer.get();
+                    writer = std::move(arrow_writer);
+                }
+                const size_t size = frozen_results.size();
+                for (; rows < size; rows++) {
+                    writer->write_row(frozen_results.get<Obj>(rows));
+                    if ((rows + 1) % batch_size == 0) {
+                        writer->flush();
+                        if (on_progress)
+                            on_progress(rows + 1);
+                    }
+                }
+                if (arrow)
+                    arrow->finish();
+                else
+                    writer->flush();
+                file.close();
+            }
+            catch (...) {
+                frozen_realm->close();
+                on_complete(rows, std::current_exception());
+                return;
+            }
+            frozen_realm->close();
+            on_complete(rows, nullptr);
+        });
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/object-store/results.hpp>
+#include <realm/object-store/shared_realm.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace realm {
+
+struct ResultsPage {
+    std::vector<Obj> objects;
+    bool has_more;
+    // The values at the key paths and the key of the last object, to continue from.
+    std::vector<Mixed> cursor_values;
+    int64_t cursor_key;
+};
+
+/**
+ * Pages through results of objects by the values of the properties they are sorted by, rather than by offset.
+ * A page starts right after the object a cursor was taken from, or where that object would be if it has since been
+ * deleted or changed, which is found by a binary search of the sorted results.
+ */
+class JsResultsPager {
+public:
+    static ResultsPage first_page(Results& results, const KeyPathArray& key_paths, size_t limit)
+    {
+        return make_page(results, key_paths, 0, limit);
+    }
+
+    // `key_paths` and `ascending` are the properties the results are sorted by, the first taking precedence.
+    // `by_key` tells if objects which are equal by those properties are ordered by key, as in results of a table.
+    static ResultsPage page_after(Results& results, const KeyPathArray& key_paths, std::vector<bool> ascending,
+                                  bool by_key, std::vector<Mixed> after_values, int64_t after_key, size_t limit)
+    {
+        if (after_values.size() != key_paths.size() || ascending.size() != key_paths.size())
+            throw std::invalid_argument("The cursor doesn't match the sorting of the results");
+
+        const size_t size = results.size();
+        auto compare = [&](size_t index) {
+            const Obj obj = results.get<Obj>(index);
+            for (size_t i = 0; i < key_paths.size(); ++i) {
+                const int order = value_at(obj, key_paths[i]).compare(after_values[i]);
+                if (order != 0)
+                    return ascending[i] ? order : -order;
+            }
+            if (by_key) {
+                const int64_t key = obj.get_key().value;
+                return key < after_key ? -1 : key > after_key ? 1 : 0;
+            }
+            return 0;
+        };
+
+        // The first object which isn't ordered before the cursor
+        size_t low = 0;
+        size_t high = size;
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (compare(middle) < 0) {
+                low = middle + 1;
+            }
+            else {
+                high = middle;
+            }
+        }
+
+        // Objects equal to the cursor are in no particular order, unless ordered by key, so the page starts after
+        // the cursor object if it's among them, or after all of them if it isn't.
+        size_t start = low;
+        for (size_t index = low; index < size && compare(index) == 0; ++index) {
+            start = index + 1;
+            if (results.get<Obj>(index).get_key().value == after_key)
+                break;
+        }
+        return make_page(results, key_paths, start, limit);
+    }
+
+private:
+    static ResultsPage make_page(Results& results, const KeyPathArray& key_paths, size_t start, size_t limit)
+    {
+        const size_t size = results.size();
+        const size_t begin = std::min(start, size);
+        const size_t end = begin + std::min(limit, size - begin);
+        ResultsPage page{{}, end < size, {}, -1};
+        page.objects.reserve(end - begin);
+        for (size_t index = begin; index < end; ++index) {
+            page.objects.push_back(results.get<Obj>(index));
+        }
+        if (!page.objects.empty()) {
+            const Obj& last = page.objects.back();
+            for (const auto& key_path : key_paths) {
+                page.cursor_values.push_back(value_at(last, key_path));
+            }
+            page.cursor_key = last.get_key().value;
+        }
+        return page;
+    }
+
+    // Follows the links of a key path, where an unset link reads as null like when sorting.
+    static Mixed value_at(Obj obj, const KeyPath& key_path)
+    {
+        for (size_t i = 0; i + 1 < key_path.size(); ++i) {
+            obj = obj.get_linked_object(key_path[i].second);
+            if (!obj.is_valid())
+                return Mixed();
+        }
+        return obj.get_any(key_path.back().second);
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace realm {
+
+/**
+ * Reads and writes the schema fingerprint stored next to a Realm file. The fingerprint itself is computed by the SDK.
+ */
+class JsSchemaFingerprint {
+public:
+    // Returns an empty string if no fingerprint has been stored.
+    static std::string read(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return {};
+        std::ostringstream out;
+        out << file.rdbuf();
+        return out.str();
+    }
+
+    // Replaces the file atomically, such that concurrent readers see either the old or the new fingerprint.
+    static void write(const std::string& path, const std::string& fingerprint)
+    {
+        const std::string temporary_path = path + ".tmp";
+        {
+            std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+            if (!file || !file.write(fingerprint.data(), std::streamsize(fingerprint.size())) || !file.flush())
+                throw std::runtime_error("Failed to write the schema fingerprint to '" + temporary_path + "'");
+        }
+        if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+            std::remove(temporary_path.c_str());
+            throw std::runtime_error("Failed to write the schema fingerprint to '" + path + "'");
+        }
+    }
+};
+
+} // namespace realm
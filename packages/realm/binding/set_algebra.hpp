@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <realm/object-store/set.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace realm {
+
+/**
+ * Compares and combines the values of a Realm Set with those of another Set or of a JS array, in a single call.
+ * The operands are matched through the Set's own lookup, such that values compare the way they do when inserted.
+ */
+class JsSetAlgebra {
+public:
+    // `relation` is one of "subset", "superset" and "intersects".
+    static bool test(const object_store::Set& set, const object_store::Set& other, const std::string& relation)
+    {
+        return test_values(set, values_of(other), relation);
+    }
+
+    static bool test_values(const object_store::Set& set, const std::vector<Mixed>& values,
+                            const std::string& relation)
+    {
+        const Match match(set, values);
+        if (relation == "subset")
+            return match.found_count == set.size();
+        if (relation == "superset")
+            return match.missing.empty();
+        if (relation == "intersects")
+            return match.found_count > 0;
+        throw std::invalid_argument("Unexpected set relation: '" + relation + "'");
+    }
+
+    // `operation` is one of "union", "intersection", "difference" and "symmetricDifference".
+    static std::vector<Mixed> combine(const object_store::Set& set, const object_store::Set& other,
+                                      const std::string& operation)
+    {
+        return combine_values(set, values_of(other), operation);
+    }
+
+    static std::vector<Mixed> combine_values(const object_store::Set& set, const std::vector<Mixed>& values,
+                                             const std::string& operation)
+    {
+        const Match match(set, values);
+        const bool keep_found = operation == "union" || operation == "intersection";
+        const bool keep_unfound = operation != "intersection";
+        const bool keep_missing = operation == "union" || operation == "symmetricDifference";
+        if (!keep_missing && operation != "intersection" && operation != "difference")
+            throw std::invalid_argument("Unexpected set operation: '" + operation + "'");
+
+        std::vector<Mixed> out;
+        for (size_t i = 0; i < set.size(); ++i) {
+            if (match.found[i] ? keep_found : keep_unfound)
+                out.push_back(to_link(set, set.get_any(i)));
+        }
+        if (keep_missing) {
+            for (const Mixed& value : match.missing)
+                out.push_back(value);
+        }
+        return out;
+    }
+
+    // Like `combine`, but updates `set` with the result. Must be called in a write transaction.
+    static void assign(object_store::Set& set, const object_store::Set& other, const std::string& operation)
+    {
+        // Values of the other Set may live in the nodes this writes to, so they are copied first.
+        std::deque<std::string> buffer;
+        assign_values(set, values_of(other, &buffer), operation);
+    }
+
+    static void assign_values(object_store::Set& set, const std::vector<Mixed>& values, const std::string& operation)
+    {
+        const Match match(set, values);
+        bool remove_found = false;
+        bool remove_unfound = false;
+        bool insert_missing = false;
+        if (operation == "union") {
+            insert_missing = true;
+        }
+        else if (operation == "intersection") {
+            remove_unfound = true;
+        }
+        else if (operation == "difference") {
+            remove_found = true;
+        }
+        else if (operation == "symmetricDifference") {
+            remove_found = true;
+            insert_missing = true;
+        }
+        else {
+            throw std::invalid_argument("Unexpected set operation: '" + operation + "'");
+        }
+
+        // Removing from the back keeps the indices of the values yet to be removed valid.
+        for (size_t i = set.size(); i-- > 0;) {
+            if (match.found[i] ? remove_found : remove_unfound)
+                set.remove_any(set.get_any(i));
+        }
+        if (insert_missing) {
+            for (const Mixed& value : match.missing)
+                set.insert_any(value);
+        }
+    }
+
+private:
+    // Which values of a Set are among the given values, and which of the given values are not in the Set.
+    struct Match {
+        Match(const object_store::Set& set, const std::vector<Mixed>& values)
+            : found(set.size(), false)
+        {
+            for (const Mixed& value : values) {
+                const size_t index = set.find_any(value);
+                if (index == not_found) {
+                    missing.push_back(value);
+                }
+                else if (!found[index]) {
+                    found[index] = true;
+                    ++found_count;
+                }
+            }
+            std::sort(missing.begin(), missing.end());
+            missing.erase(std::unique(missing.begin(), missing.end()), missing.end());
+        }
+
+        std::vector<bool> found;
+        size_t found_count = 0;
+        std::vector<Mixed> missing;
+    };
+
+    // Strings and binary values are copied into `buffer` if given, to outlive writes to the Realm.
+    static std::vector<Mixed> values_of(const object_store::Set& set, std::deque<std::string>* buffer = nullptr)
+    {
+        std::vector<Mixed> values;
+        values.reserve(set.size());
+        for (size_t i = 0; i < set.size(); ++i) {
+            Mixed value = to_link(set, set.get_any(i));
+            if (buffer && value.is_type(type_String)) {
+                buffer->emplace_back(value.get_string());
+                value = Mixed(StringData(buffer->back()));
+            }
+            else if (buffer && value.is_type(type_Binary)) {
+                const BinaryData data = value.get_binary();
+                buffer->emplace_back(data.data(), data.size());
+                value = Mixed(BinaryData(buffer->back().data(), buffer->back().size()));
+            }
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    // Sets of objects hold plain keys, which need the table they point into to be read as objects.
+    static Mixed to_link(const object_store::Set& set, Mixed value)
+    {
+        if (value.is_type(type_Link))
+            return ObjLink(set.get_impl().get_target_table()->get_key(), value.get<ObjKey>());
+        return value;
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace realm {
+namespace js {
+namespace trace {
+
+using clock = std::chrono::steady_clock;
+
+struct TraceEvent {
+    std::string category;
+    std::string name;
+    std::string detail;
+    clock::time_point start;
+    clock::duration duration;
+};
+
+/*
+ * The events recorded by a single thread. Only the owning thread appends, and it publishes each event by a release
+ * store of the size, so events below the size can be read from another thread without any locking.
+ * Events recorded once the buffer is full are counted and dropped.
+ */
+class TraceBuffer {
+public:
+    TraceBuffer(size_t capacity, size_t thread_id, std::string thread_name)
+        : m_capacity(capacity)
+        , m_thread_id(thread_id)
+        , m_thread_name(std::move(thread_name))
+    {
+        // Reserving up front means appending never reallocates the events another thread may be reading.
+        m_events.reserve(capacity);
+    }
+
+    void append(TraceEvent event)
+    {
+        const size_t size = m_size.load(std::memory_order_relaxed);
+        if (size == m_capacity) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        m_events.push_back(std::move(event));
+        m_size.store(size + 1, std::memory_order_release);
+    }
+
+    size_t size() const noexcept
+    {
+        return m_size.load(std::memory_order_acquire);
+    }
+
+    const TraceEvent& operator[](size_t index) const noexcept
+    {
+        return m_events.data()[index];
+    }
+
+    size_t dropped() const noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    size_t thread_id() const noexcept
+    {
+        return m_thread_id;
+    }
+
+    const std::string& thread_name() const noexcept
+    {
+        return m_thread_name;
+    }
+
+private:
+    const size_t m_capacity;
+    const size_t m_thread_id;
+    const std::string m_thread_name;
+    std::vector<TraceEvent> m_events;
+    std::atomic<size_t> m_size{0};
+    std::atomic<size_t> m_dropped{0};
+};
+
+/*
+ * Records timed events from any thread while tracing, into a buffer per thread per session.
+ * Checking whether tracing is enabled is a single relaxed load, which is all an instrumented call costs otherwise.
+ * The mutex is only taken by a thread recording its first event of a session, and to start or stop a session.
+ */
+class TraceRecorder {
+public:
+    static TraceRecorder& get()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+
+    static bool is_enabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Name the calling thread in the traces recorded from now on.
+    static void set_thread_name(std::string name)
+    {
+        local().name = std::move(name);
+    }
+
+    void start(size_t events_per_thread)
+    {
+        std::lock_guard lock(m_mutex);
+        m_buffers.clear();
+        m_events_per_thread = events_per_thread;
+        m_epoch = clock::now();
+        m_session.fetch_add(1, std::memory_order_relaxed);
+        s_enabled.store(true, std::memory_order_release);
+    }
+
+    // Disables tracing and returns the buffers of the session. A thread may still be appending to its buffer,
+    // which is safe as only the events it has published are read.
+    std::vector<std::shared_ptr<const TraceBuffer>> stop()
+    {
+        std::lock_guard lock(m_mutex);
+        s_enabled.store(false, std::memory_order_relaxed);
+        return std::exchange(m_buffers, {});
+    }
+
+    clock::time_point epoch() const noexcept
+    {
+        return m_epoch;
+    }
+
+    void record(std::string category, std::string name, clock::time_point start, clock::duration duration,
+                std::string detail = {})
+    {
+        if (!is_enabled())
+            return;
+        if (auto buffer = buffer_for_this_thread())
+            buffer->append({std::move(category), std::move(name), std::move(detail), start, duration});
+    }
+
+private:
+    struct ThreadState {
+        std::string name;
+        uint64_t session = 0;
+        std::shared_ptr<TraceBuffer> buffer;
+    };
+
+    static ThreadState& local()
+    {
+        static thread_local ThreadState state;
+        return state;
+    }
+
+    TraceBuffer* buffer_for_this_thread()
+    {
+        auto& state = local();
+        const auto session = m_session.load(std::memory_order_relaxed);
+        if (state.session != session || !state.buffer) {
+            std::lock_guard lock(m_mutex);
+            if (!is_enabled())
+                return nullptr;
+            state.session = m_session.load(std::memory_order_relaxed);
+            state.buffer = std::make_shared<TraceBuffer>(m_events_per_thread, m_buffers.size() + 1,
+                                                         state.name.empty() ? "Thread" : state.name);
+            m_buffers.push_back(state.buffer);
+        }
+        return state.buffer.get();
+    }
+
+    static inline std::atomic<bool> s_enabled{false};
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<const TraceBuffer>> m_buffers;
+    size_t m_events_per_thread = 0;
+    clock::time_point m_epoch;
+    std::atomic<uint64_t> m_session{0};
+};
+
+/*
+ * Records the time from construction to destruction as an event, if tracing was enabled when constructed.
+ */
+class TraceScope {
+public:
+    TraceScope(const char* category, const char* name) noexcept
+        : m_category(category)
+        , m_name(name)
+        , m_enabled(TraceRecorder::is_enabled())
+    {
+        if (m_enabled)
+            m_start = clock::now();
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+        if (m_enabled)
+            TraceRecorder::get().record(m_category, m_name, m_start, clock::now() - m_start, std::move(m_detail));
+    }
+
+    // Only worth calling if tracing is enabled, as the scope discards the detail otherwise.
+    void set_detail(std::string detail)
+    {
+        if (m_enabled)
+            m_detail = std::move(detail);
+    }
+
+private:
+    const char* const m_category;
+    const char* const m_name;
+    const bool m_enabled;
+    clock::time_point m_start;
+    std::string m_detail;
+};
+
+} // namespace trace
+} // namespace js
+} // namespace realm
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "json_string.hpp"
+#include "trace_events.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace realm {
+
+/*
+ * Records a timeline of what the SDK and the Realms do, as Chrome trace events which can be viewed in Perfetto
+ * (https://ui.perfetto.dev) or chrome://tracing. Events are recorded natively by the write transactions,
+ * notification callbacks, scheduler and log writer, and from JS by calls into the binding and garbage collections.
+ * The log writer is the thread of the native log sinks, which replaced the SyncLoggerDelegator, so its drains are
+ * the ones of the log queue.
+ */
+class JsTraceRecorder {
+public:
+    static void start(size_t events_per_thread)
+    {
+        js::trace::TraceRecorder::get().start(events_per_thread);
+    }
+
+    static bool is_enabled()
+    {
+        return js::trace::TraceRecorder::is_enabled();
+    }
+
+    static void name_thread(const std::string& name)
+    {
+        js::trace::TraceRecorder::set_thread_name(name);
+    }
+
+    // Microseconds since tracing started, for JS to convert its own timestamps into those of the trace.
+    static double now_us()
+    {
+        return to_us(js::trace::clock::now() - js::trace::TraceRecorder::get().epoch());
+    }
+
+    static void record(const std::string& category, const std::string& name, double start_us, double duration_us,
+                       const std::string& detail)
+    {
+        auto& recorder = js::trace::TraceRecorder::get();
+        const auto start = recorder.epoch() + from_us(start_us);
+        recorder.record(category, name, start, from_us(duration_us), detail);
+    }
+
+    // Stops tracing and returns the events recorded since it was started, in the JSON object format.
+    static std::string stop()
+    {
+        auto& recorder = js::trace::TraceRecorder::get();
+        const auto buffers = recorder.stop();
+        const auto epoch = recorder.epoch();
+
+        std::string out = "{\"traceEvents\":[";
+        out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Realm\"}}";
+        size_t dropped = 0;
+        for (const auto& buffer : buffers) {
+            const auto tid = std::to_string(buffer->thread_id());
+            out += ",{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":";
+            js::append_json_string(out, buffer->thread_name());
+            out += "}}";
+            const size_t size = buffer->size();
+            for (size_t i = 0; i < size; i++) {
+                const auto& event = (*buffer)[i];
+                out += ",{\"name\":";
+                js::append_json_string(out, event.name);
+                out += ",\"cat\":";
+                js::append_json_string(out, event.category);
+                out += ",\"ph\":\"X\",\"pid\":1,\"tid\":" + tid;
+                out += ",\"ts\":" + format_us(event.start - epoch);
+                out += ",\"dur\":" + format_us(event.duration);
+                if (!event.detail.empty()) {
+                    out += ",\"args\":{\"detail\":";
+                    js::append_json_string(out, event.detail);
+                    out += "}";
+                }
+                out += "}";
+            }
+            dropped += buffer->dropped();
+        }
+        out += "],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" + std::to_string(dropped) + "}}";
+        return out;
+    }
+
+private:
+    static double to_us(js::trace::clock::duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    static js::trace::clock::duration from_us(double us)
+    {
+        return std::chrono::duration_cast<js::trace::clock::duration>(std::chrono::duration<double, std::micro>(us));
+    }
+
+    // Chrome trace events are in microseconds, and take fractions for finer resolution.
+    static std::string format_us(js::trace::clock::duration duration)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.3f", to_us(duration));
+        return buffer;
+    }
+};
+
+} // namespace realm
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { assert } from "./assert";
+
+/**
+ * The objects of a type which changed between two versions of a Realm, identified by their object keys,
+ * as returned by {@link Realm.Object._objectKey}.
+ * @since 12.16.0
+ */
+export type ObjectTypeChanges = {
+  /** The keys of the objects inserted, in ascending order. */
+  insertions: string[];
+  /** The keys of the objects modified, in ascending order. Objects which were also inserted are left out. */
+  modifications: { objectKey: string; changedProperties: string[] }[];
+  /** The keys of the objects deleted, in ascending order. */
+  deletions: string[];
+};
+
+/**
+ * The changes returned by {@link Realm.changesSince}.
+ * @since 12.16.0
+ */
+export type ChangesSince = {
+  /** The token of the version the changes lead up to, to pass to the next call. */
+  token: string;
+  /**
+   * `true` if the changes since the token passed are unknown, such that the consumer needs to read the Realm
+   * from scratch, before continuing from `token`. This is the case on the first call, and when the version
+   * of the token is no longer in the file, such as for a token kept across a restart of the process.
+   */
+  reset: boolean;
+  /** The changes per object type. Object types without changes are left out. */
+  changes: Record<string, ObjectTypeChanges>;
+};
+
+const TOKEN_PATTERN = /^(\d+)\.(\d+)$/;
+
+/** @internal */
+export function getChangesSince(realm: binding.Realm, token: string | undefined): ChangesSince {
+  let version = 0;
+  let index = 0;
+  if (token !== undefined) {
+    assert.string(token, "token");
+    const match = TOKEN_PATTERN.exec(token);
+    assert(match, `Expected a change token returned by 'changesSince', got '${token}'`);
+    version = Number(match[1]);
+    index = Number(match[2]);
+  }
+  const feed = binding.JsChangeFeed.changesSince(realm, version, index);
+  const changes: Record<string, ObjectTypeChanges> = {};
+  for (const table of feed.tables) {
+    changes[table.objectType] = {
+      insertions: table.insertions,
+      modifications: table.modifications.map((objectKey, i) => ({
+        objectKey,
+        changedProperties: table.modifiedProperties[i],
+      })),
+      deletions: table.deletions,
+    };
+  }
+  return { token: `${feed.version}.${feed.index}`, reset: feed.reset, changes };
+}
@@ -16,7 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-import type { binding } from "./binding";
+import { binding } from "./binding";
 import type { CanonicalObjectSchema, DefaultObject, RealmObjectConstructor } from "./schema";
 import type { PropertyMap } from "./PropertyMap";
 import type { RealmObject } from "./Object";
@@ -59,3 +59,14 @@ export function getClassHelpers(arg: typeof RealmObject): ClassHelpers {
     throw new Error(`Expected INTERNAL_HELPERS to be set on the '${arg.name}' class`);
   }
 }
+
+/**
+ * Get the persisted properties which are neither links nor collections, i.e. the ones which can be exported and imported.
+ * @internal
+ */
+export function getPrimitiveProperties({ persistedProperties }: binding.ObjectSchema): binding.Property[] {
+  return persistedProperties.filter(
+    ({ type }) =>
+      !(type & binding.PropertyType.Collection) && (type & ~binding.PropertyType.Flags) !== binding.PropertyType.Object,
+  );
+}
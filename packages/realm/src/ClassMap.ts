@@ -17,17 +17,35 @@
 ////////////////////////////////////////////////////////////////////////////
 
 import type { CanonicalObjectSchema, Constructor, RealmObjectConstructor } from "./schema";
-import type { binding } from "./binding";
+import { binding } from "./binding";
 import { PropertyMap } from "./PropertyMap";
 import { KEY_ARRAY, KEY_SET, RealmObject } from "./Object";
 import { assert } from "./assert";
 import { getClassHelpers, setClassHelpers } from "./ClassHelpers";
 import { OBJECT_INTERNAL, OBJECT_REALM } from "./symbols";
+import { flags } from "./flags";
+import { isInScope } from "./Scope";
+
+/**
+ * Property types which object hosts read and write directly.
+ * @see {@link flags.OBJECT_HOST_FAST_PATH}
+ */
+const HOST_OBJECT_PROPERTY_TYPES = new Set([
+  binding.PropertyType.Int,
+  binding.PropertyType.Bool,
+  binding.PropertyType.Float,
+  binding.PropertyType.Double,
+  binding.PropertyType.String,
+]);
+
+/** @internal */
+type ObjectHostLayoutRef = { current: binding.ObjectHostLayout | null };
 
 /** @internal */
 export class ClassMap {
   private mapping: Record<string, Constructor<unknown>>;
   private nameByTableKey: Record<binding.TableKey, string>;
+  private hostLayouts = new Map<string, ObjectHostLayoutRef>();
 
   private static createNamedConstructor<T extends Constructor>(name: string): T {
     const result = function () {
@@ -100,6 +118,32 @@ export class ClassMap {
     });
   }
 
+  private static createObjectHostLayout(
+    schema: binding.ObjectSchema,
+    canonicalSchema: CanonicalObjectSchema,
+  ): binding.ObjectHostLayout | null {
+    const { createObjectHostLayout } = binding;
+    if (!flags.OBJECT_HOST_FAST_PATH || !createObjectHostLayout) {
+      return null;
+    }
+    const properties = [...schema.persistedProperties, ...schema.computedProperties];
+    const fields: binding.ObjectHostField[] = [];
+    for (const property of schema.persistedProperties) {
+      const name = property.publicName || property.name;
+      // Presentations (e.g. counters) need the JS property accessors
+      if (
+        HOST_OBJECT_PROPERTY_TYPES.has(property.type & ~binding.PropertyType.Nullable) &&
+        !canonicalSchema.properties[name]?.presentation
+      ) {
+        fields.push({ name, columnKey: property.columnKey, type: property.type, writable: !property.isPrimary });
+      }
+    }
+    return createObjectHostLayout(
+      properties.map((p) => p.publicName || p.name),
+      fields,
+    );
+  }
+
   constructor(
     realm: Realm,
     realmSchema: readonly binding.ObjectSchema[],
@@ -113,6 +157,9 @@ export class ClassMap {
         const constructor = ClassMap.createClass(objectSchema, canonicalObjectSchema.ctor);
         // Create property getters and setters
         const properties = new PropertyMap();
+        // Created once all classes are defined, as objects are not wrapped before that
+        const hostLayout: ObjectHostLayoutRef = { current: null };
+        this.hostLayouts.set(objectSchema.name, hostLayout);
         // Setting the helpers on the class
         setClassHelpers(constructor, {
           constructor,
@@ -121,7 +168,11 @@ export class ClassMap {
           properties,
           wrapObject(obj) {
             if (obj.isValid) {
-              return RealmObject.createWrapper(obj, constructor);
+              const result = RealmObject.createWrapper(obj, constructor);
+              // A host object reads its own copy of the Obj, which a scope can't release, so none are made in scopes.
+              return hostLayout.current && !isInScope()
+                ? ClassMap.createObjectHost(hostLayout.current, obj, result)
+                : result;
             } else {
               return null;
             }
@@ -150,9 +201,25 @@ export class ClassMap {
       });
       // Transfer property getters and setters onto the prototype of the class
       ClassMap.defineProperties(constructor, objectSchema, properties, realm);
+      const hostLayout = this.hostLayouts.get(objectSchema.name);
+      assert(hostLayout);
+      hostLayout.current = ClassMap.createObjectHostLayout(objectSchema, canonicalObjectSchema);
     }
   }
 
+  private static createObjectHost(
+    layout: binding.ObjectHostLayout,
+    obj: binding.Obj,
+    companion: RealmObject,
+  ): RealmObject {
+    assert(binding.createObjectHost);
+    const host = binding.createObjectHost(layout, obj, companion);
+    // Host objects forward everything but the properties in the layout to the companion, including methods,
+    // but the prototype is needed for `instanceof` to keep working.
+    Object.setPrototypeOf(host, Object.getPrototypeOf(companion));
+    return host;
+  }
+
   public get<T>(arg: string | binding.TableKey | RealmObject<T> | Constructor<RealmObject<T>>): Constructor<T> {
     if (typeof arg === "string") {
       const constructor = this.mapping[arg];
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+import { binding } from "./binding";
+
+/**
+ * Options controlling when the changes merged by {@link addCoalescedNotificationCallback} are delivered.
+ * @internal
+ */
+export type CoalescingOptions = {
+  minIntervalMs: number;
+  maxDelayMs: number;
+};
+
+/**
+ * Add a notification callback to `results` which is called with the changes of every commit since it was last
+ * called merged into one change set, once changes have stopped arriving for `minIntervalMs` or the first of them
+ * arrived `maxDelayMs` ago. The change sets are merged natively, so the callback is only crossed into when it's due.
+ * The first notification, for the initial state of the collection, is delivered right away.
+ * @internal
+ */
+export function addCoalescedNotificationCallback(
+  results: binding.Results,
+  keyPaths: binding.KeyPathArray | undefined,
+  callback: (changes: binding.CollectionChangeSet) => void,
+  { minIntervalMs, maxDelayMs }: CoalescingOptions,
+): Pick<binding.NotificationToken, "unregister"> {
+  const coalescer = binding.ChangeCoalescer.make();
+  let initial = true;
+  let firstPendingAt = 0;
+  let timer: Timer | null = null;
+
+  const flush = () => {
+    timer = null;
+    callback(coalescer.take());
+  };
+
+  const check = () => {
+    const idle = coalescer.idleMs();
+    const waited = performance.now() - firstPendingAt;
+    if (idle >= minIntervalMs || waited >= maxDelayMs) {
+      flush();
+    } else {
+      timer = setTimeout(check, Math.min(minIntervalMs - idle, maxDelayMs - waited));
+    }
+  };
+
+  const token = coalescer.addNotificationCallback(results, keyPaths, () => {
+    if (initial) {
+      initial = false;
+      flush();
+    } else {
+      firstPendingAt = performance.now();
+      timer = setTimeout(check, minIntervalMs);
+    }
+  });
+
+  return {
+    unregister() {
+      if (timer !== null) {
+        clearTimeout(timer);
+        timer = null;
+      }
+      token.unregister();
+    },
+  };
+}
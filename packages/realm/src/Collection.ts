@@ -47,6 +47,51 @@ export const COLLECTION_TYPE_HELPERS = Symbol("Collection#typeHelpers");
  */
 type CollectionAccessor<T = unknown> = OrderedCollectionAccessor<T> | DictionaryAccessor<T>;
 
+/**
+ * Options for {@link Collection.addListener}.
+ */
+export type CollectionListenerOptions = {
+  /**
+   * Indicates a lower bound on the changes relevant for the listener, see {@link Collection.addListener}.
+   */
+  keyPaths?: string | string[];
+  /**
+   * Include the keys of the deleted, inserted and modified objects in the change set, as returned by
+   * {@link Realm.Object._objectKey}. Only applies to lists and results of objects, and costs keeping the key of
+   * every object in the collection in memory.
+   * @since 12.16.0
+   */
+  objectKeys?: boolean;
+  /**
+   * Call the listener at most once per this many milliseconds, with the changes of every commit since it was last
+   * called merged into a single change set. Merging happens natively, such that a collection written to many times
+   * per second costs a listener a single change set per interval. The first call, for the initial state of the
+   * collection, is not delayed. Only applies to lists, sets and results, adding a listener of a dictionary with it
+   * throws.
+   * @since 12.16.0
+   */
+  minIntervalMs?: number;
+  /**
+   * Wait for changes to stop arriving for `minIntervalMs` before calling the listener, but for at most this many
+   * milliseconds after the first change it hasn't been called with. The default is `minIntervalMs`, which calls the
+   * listener `minIntervalMs` after the first change, however often the collection changes in the meantime.
+   * @since 12.16.0
+   */
+  maxDelayMs?: number;
+};
+
+/**
+ * Arguments passed when adding a listener to the binding collection.
+ * @internal
+ */
+type ListenerArgs = [keyPaths: string[] | undefined, options: CollectionListenerOptions];
+
+/**
+ * A notification token, or a subscription to a notifier shared by identical queries.
+ * @internal
+ */
+type ListenerToken = Pick<binding.NotificationToken, "unregister">;
+
 /**
  * Abstract base class containing methods shared by Realm {@link List}, {@link Dictionary}, {@link Results} and {@link RealmSet}.
  *
@@ -79,13 +124,13 @@ export abstract class Collection<
   protected readonly [COLLECTION_TYPE_HELPERS]: TypeHelpers<ValueType>;
 
   /** @internal */
-  private listeners: Listeners<ChangeCallbackType, binding.NotificationToken, [string[] | undefined]>;
+  private listeners: Listeners<ChangeCallbackType, ListenerToken, ListenerArgs>;
 
   /** @internal */
   constructor(
     accessor: Accessor,
     typeHelpers: TypeHelpers<ValueType>,
-    addListener: CallbackAdder<ChangeCallbackType, binding.NotificationToken, [string[] | undefined]>,
+    addListener: CallbackAdder<ChangeCallbackType, ListenerToken, ListenerArgs>,
   ) {
     if (arguments.length === 0) {
       throw new IllegalConstructorError("Collection");
@@ -156,7 +201,7 @@ export abstract class Collection<
   /**
    * Add a listener `callback` which will be called when a **live** collection instance changes.
    * @param callback - A function to be called when changes occur.
-   * @param keyPaths - Indicates a lower bound on the changes relevant for the listener. This is a lower bound, since if multiple listeners are added (each with their own `keyPaths`) the union of these key-paths will determine the changes that are considered relevant for all listeners registered on the collection. In other words: A listener might fire more than the key-paths specify, if other listeners with different key-paths are present.
+   * @param keyPathsOrOptions - Either the key-paths or {@link CollectionListenerOptions}. Key-paths indicate a lower bound on the changes relevant for the listener. This is a lower bound, since if multiple listeners are added (each with their own `keyPaths`) the union of these key-paths will determine the changes that are considered relevant for all listeners registered on the collection. In other words: A listener might fire more than the key-paths specify, if other listeners with different key-paths are present.
    * @note `deletions` and `oldModifications` report the indices in the collection before the change happened,
    * while `insertions` and `newModifications` report the indices into the new version of the collection.
    * @throws A {@link TypeAssertionError} if `callback` is not a function.
@@ -176,10 +221,33 @@ export abstract class Collection<
    * wines.addListener((collection, changes) => {
    *  console.log("A wine's brand might have changed");
    * }, ["brand"]);
+   * @example
+   * wines.addListener((collection, changes) => {
+   *  console.log(`Objects with keys ${changes.objectKeys?.deletions} were deleted`);
+   * }, { objectKeys: true });
+   * @example
+   * trades.addListener((collection, changes) => {
+   *  console.log(`${changes.insertions.length} trades in the last second`);
+   * }, { minIntervalMs: 1000 });
    */
-  addListener(callback: ChangeCallbackType, keyPaths?: string | string[]): void {
+  addListener(callback: ChangeCallbackType, keyPathsOrOptions?: string | string[] | CollectionListenerOptions): void {
     assert.function(callback, "callback");
-    this.listeners.add(callback, typeof keyPaths === "string" ? [keyPaths] : keyPaths);
+    const options =
+      typeof keyPathsOrOptions === "string" || Array.isArray(keyPathsOrOptions)
+        ? { keyPaths: keyPathsOrOptions }
+        : keyPathsOrOptions ?? {};
+    assert.object(options, "options");
+    const { keyPaths, minIntervalMs, maxDelayMs } = options;
+    if (minIntervalMs !== undefined) {
+      assert.number(minIntervalMs, "minIntervalMs");
+      assert(minIntervalMs > 0, "Expected 'minIntervalMs' to be positive");
+    }
+    if (maxDelayMs !== undefined) {
+      assert.number(maxDelayMs, "maxDelayMs");
+      assert(minIntervalMs !== undefined, "Expected 'minIntervalMs' when passing 'maxDelayMs'");
+      assert(maxDelayMs >= minIntervalMs, "Expected 'maxDelayMs' to be at least 'minIntervalMs'");
+    }
+    this.listeners.add(callback, typeof keyPaths === "string" ? [keyPaths] : keyPaths, options);
   }
 
   /**
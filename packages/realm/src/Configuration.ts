@@ -73,6 +73,27 @@ export type BaseConfiguration = {
    * @since 0.11.0
    */
   schemaVersion?: number;
+  /**
+   * Store a fingerprint of the `schema` and `schemaVersion` next to the Realm file (at its path with a
+   * `.fingerprint` suffix). When opening the Realm with a schema matching the stored fingerprint, the schema is
+   * read from the file instead of being converted and compared against it, which speeds up opening Realms with
+   * large schemas. Falls back to passing the schema if the file doesn't match, e.g. after another process migrated it.
+   * When the schema is read from the file, {@link Realm.schema} lists the object types and properties in the order
+   * they were added to the file. Ignored for synced and in-memory Realms.
+   * @default false
+   * @since 12.16.0
+   */
+  schemaFingerprint?: boolean;
+  /**
+   * Share the native results of identical queries, such that listeners on them share a single notifier which
+   * computes the changes once per commit, rather than once per listener. Applies to the results of
+   * {@link Realm.objects}, and to the results of `filtered` and `sorted` on those, which are identical if they are of
+   * the same object type with the same query, arguments and sorting. Listeners added with key paths or other
+   * options get native callbacks of their own.
+   * @default false
+   * @since 12.16.0
+   */
+  shareQueries?: boolean;
   /**
    * Specifies if this Realm should be opened in-memory. This
    * still requires a path (can be the default path) to identify the Realm so other processes can
@@ -188,6 +209,8 @@ export function validateConfiguration(config: unknown): asserts config is Config
     path,
     schema,
     schemaVersion,
+    schemaFingerprint,
+    shareQueries,
     inMemory,
     readOnly,
     fifoFilesFallbackPath,
@@ -215,6 +238,12 @@ export function validateConfiguration(config: unknown): asserts config is Config
       "'schemaVersion' on realm configuration must be 0 or a positive integer.",
     );
   }
+  if (schemaFingerprint !== undefined) {
+    assert.boolean(schemaFingerprint, "'schemaFingerprint' on realm configuration");
+  }
+  if (shareQueries !== undefined) {
+    assert.boolean(shareQueries, "'shareQueries' on realm configuration");
+  }
   if (inMemory !== undefined) {
     assert.boolean(inMemory, "'inMemory' on realm configuration");
   }
@@ -18,17 +18,15 @@
 
 import { assert } from "./assert";
 import { binding } from "./binding";
-import { indirect, injectIndirect } from "./indirect";
+import { injectIndirect } from "./indirect";
 import { COLLECTION_ACCESSOR as ACCESSOR, Collection, COLLECTION_TYPE_HELPERS as TYPE_HELPERS } from "./Collection";
 import { AssertionError, IllegalConstructorError } from "./errors";
 import type { DefaultObject } from "./schema";
 import { JSONCacheMap } from "./JSONCacheMap";
 import type { Realm } from "./Realm";
-import { toItemType } from "./TypeHelpers";
 import type { TypeHelpers } from "./TypeHelpers";
 import { RealmObject } from "./Object";
 import type { DictionaryAccessor } from "./collection-accessors/Dictionary";
-import { createResultsAccessor } from "./collection-accessors/Results";
 
 /* eslint-disable jsdoc/multiline-blocks -- We need this to have @ts-expect-error located correctly in the .d.ts bundle */
 
@@ -41,6 +39,17 @@ export type DictionaryChangeSet = {
   insertions: string[];
 };
 
+/**
+ * Options for {@link Dictionary.entriesOf}.
+ * @since 12.16.0
+ */
+export type DictionaryEntriesOptions = {
+  /** Only include the keys starting with this prefix. */
+  prefix?: string;
+  /** Only include these keys. Keys which don't exist in the dictionary are skipped. */
+  keys?: string[];
+};
+
 export type DictionaryChangeCallback<T = unknown> = (dictionary: Dictionary<T>, changes: DictionaryChangeSet) => void;
 
 const DEFAULT_PROPERTY_DESCRIPTOR: PropertyDescriptor = { configurable: true, enumerable: true };
@@ -76,12 +85,8 @@ const PROXY_HANDLER: ProxyHandler<Dictionary> = {
   ownKeys(target) {
     const internal = target[INTERNAL];
     const result: (string | symbol)[] = Reflect.ownKeys(target);
-    const keys = internal.keys.snapshot();
-    for (let i = 0; i < keys.size(); i++) {
-      const key = keys.getAny(i);
-      assert.string(key, "dictionary key");
-      result.push(key);
-    }
+    const { keys } = binding.JsDictionaryHelpers.getEntries(internal, "", [], false);
+    result.push(...keys);
     return result;
   },
   getOwnPropertyDescriptor(target, prop) {
@@ -135,7 +140,12 @@ export class Dictionary<T = unknown> extends Collection<
     if (arguments.length === 0 || !(internal instanceof binding.Dictionary)) {
       throw new IllegalConstructorError("Dictionary");
     }
-    super(accessor, typeHelpers, (listener, keyPaths) => {
+    super(accessor, typeHelpers, (listener, keyPaths, { minIntervalMs, maxDelayMs }) => {
+      // Changes to dictionaries are delivered by key, which the native coalescing of change sets doesn't merge.
+      assert(
+        minIntervalMs === undefined && maxDelayMs === undefined,
+        "Expected no 'minIntervalMs' or 'maxDelayMs' for a listener of a dictionary",
+      );
       return this[INTERNAL].addKeyBasedNotificationCallback(
         ({ deletions, insertions, modifications }) => {
           try {
@@ -196,13 +206,7 @@ export class Dictionary<T = unknown> extends Collection<
    * @since 10.5.0
    * @ts-expect-error We're exposing methods in the end-users namespace of keys */
   *keys(): Generator<string> {
-    const snapshot = this[INTERNAL].keys.snapshot();
-    const size = snapshot.size();
-    for (let i = 0; i < size; i++) {
-      const key = snapshot.getAny(i);
-      assert.string(key);
-      yield key;
-    }
+    yield* binding.JsDictionaryHelpers.getEntries(this[INTERNAL], "", [], false).keys;
   }
 
   /**
@@ -211,14 +215,7 @@ export class Dictionary<T = unknown> extends Collection<
    * @since 10.5.0
    * @ts-expect-error We're exposing methods in the end-users namespace of values */
   *values(): Generator<T> {
-    const realm = this[REALM];
-    const values = this[INTERNAL].values;
-    const itemType = toItemType(values.type);
-    const typeHelpers = this[TYPE_HELPERS];
-    const accessor = createResultsAccessor({ realm, typeHelpers, itemType });
-    const results = new indirect.Results<T>(realm, values, accessor, typeHelpers);
-
-    for (const value of results.values()) {
+    for (const [, value] of Dictionary.readEntries(this, "", [])) {
       yield value;
     }
   }
@@ -229,22 +226,7 @@ export class Dictionary<T = unknown> extends Collection<
    * @since 10.5.0
    * @ts-expect-error We're exposing methods in the end-users namespace of entries */
   *entries(): Generator<[string, T]> {
-    const keys = this[INTERNAL].keys.snapshot();
-    const snapshot = this[INTERNAL].values.snapshot();
-    const size = keys.size();
-    assert(size === snapshot.size(), "Expected keys and values to equal in size");
-
-    const realm = this[REALM];
-    const itemType = toItemType(snapshot.type);
-    const typeHelpers = this[TYPE_HELPERS];
-    const accessor = createResultsAccessor({ realm, typeHelpers, itemType });
-    const results = new indirect.Results<T>(realm, snapshot, accessor, typeHelpers);
-
-    for (let i = 0; i < size; i++) {
-      const key = keys.getAny(i);
-      const value = results[i];
-      yield [key, value] as [string, T];
-    }
+    yield* Dictionary.readEntries(this, "", []);
   }
 
   /**
@@ -320,9 +302,43 @@ export class Dictionary<T = unknown> extends Collection<
   /** @internal */
   toJSON(_?: string, cache = new JSONCacheMap()): DefaultObject {
     return Object.fromEntries(
-      Object.entries(this).map(([k, v]) => [k, v instanceof RealmObject ? v.toJSON(k, cache) : v]),
+      Dictionary.readEntries(this, "", []).map(([k, v]) => [k, v instanceof RealmObject ? v.toJSON(k, cache) : v]),
     );
   }
+
+  /**
+   * Get the entries of a dictionary, optionally only some of them, reading them in a single call to the database.
+   * This is faster than iterating {@link Dictionary.entries} key by key for large dictionaries.
+   * It's static, as the methods of a dictionary share their namespace with its keys.
+   * @param dictionary - The dictionary to read.
+   * @param options - Only include the keys starting with `prefix`, or only the given `keys` which exist.
+   * @returns An array of key/value pairs, ordered like {@link Dictionary.entries}.
+   * @since 12.16.0
+   */
+  static entriesOf<T>(dictionary: Dictionary<T>, options: DictionaryEntriesOptions = {}): [string, T][] {
+    const { prefix = "", keys = [] } = options;
+    assert.instanceOf(dictionary, Dictionary, "dictionary");
+    assert.string(prefix, "prefix");
+    assert.array(keys, "keys");
+    for (const key of keys) {
+      assert.string(key, "key");
+    }
+    return Dictionary.readEntries(dictionary, prefix, keys);
+  }
+
+  /** @internal */
+  private static readEntries<T>(dictionary: Dictionary<T>, prefix: string, keys: string[]): [string, T][] {
+    const internal = dictionary[INTERNAL];
+    const accessor = dictionary[ACCESSOR];
+    const { fromBinding } = dictionary[TYPE_HELPERS];
+    const entries = binding.JsDictionaryHelpers.getEntries(internal, prefix, keys, true);
+    return entries.keys.map((key, i) => {
+      const value = entries.values[i];
+      // Collections nested in a dictionary of mixed values are wrapped by the accessor.
+      const isCollection = value === binding.ListSentinel || value === binding.DictionarySentinel;
+      return [key, isCollection ? accessor.get(internal, key) : (fromBinding(value) as T)];
+    });
+  }
 }
 
 /* eslint-disable-next-line @typescript-eslint/no-explicit-any -- We define these once to avoid using "any" through the code */
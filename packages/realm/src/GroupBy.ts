@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { assert } from "./assert";
+import type { BSON } from "./bson";
+import type { Realm } from "./Realm";
+
+/**
+ * An aggregate computed per group by {@link GroupBy.aggregate}.
+ *
+ * `"count"`
+ * : The number of objects in the group, or of non-null values of the property if one is given.
+ *
+ * `"sum"`, `"avg"`
+ * : The sum or average of an int, float or double property, ignoring null values.
+ *
+ * `"min"`, `"max"`
+ * : The smallest or largest value of an int, float, double or date property, ignoring null values.
+ * @since 12.16.0
+ */
+export type AggregateOperation = "count" | "sum" | "min" | "max" | "avg";
+
+/**
+ * An operation and the key path of the property to apply it to, such as `["sum", "amount"]` or `["count"]`.
+ * @since 12.16.0
+ */
+export type Aggregation = readonly ["count"] | readonly [AggregateOperation, string];
+
+/**
+ * The aggregates to compute per group, by the name to return them under.
+ * @since 12.16.0
+ */
+export type AggregateSpec = Record<string, Aggregation>;
+
+/**
+ * The value of a key path identifying a group.
+ * @since 12.16.0
+ */
+export type GroupKey =
+  | string
+  | number
+  | boolean
+  | Date
+  | BSON.ObjectId
+  | BSON.UUID
+  | BSON.Decimal128
+  | ArrayBuffer
+  | null;
+
+/**
+ * The groups and their aggregates as columns: for a group at index `i`, `keys[keyPath][i]` are its keys and
+ * `values[name][i]` its aggregates. The groups are in the order they first occur in the collection.
+ * @since 12.16.0
+ */
+export type GroupedAggregates<Spec extends AggregateSpec = AggregateSpec> = {
+  /** The number of groups. */
+  length: number;
+  keys: Record<string, GroupKey[]>;
+  values: { [Name in keyof Spec]: (number | Date | null)[] };
+};
+
+const AGGREGATE_OPERATIONS: readonly string[] = ["count", "sum", "min", "max", "avg"];
+
+/**
+ * Objects of a collection grouped by the values of one or more key paths, returned by {@link Results.groupBy}.
+ * Grouping and aggregation happen natively, in a single pass over the collection.
+ * @since 12.16.0
+ */
+export class GroupBy {
+  /** @internal */
+  private readonly realm: Realm;
+  /** @internal */
+  private readonly results: binding.Results;
+  /** @internal */
+  private readonly keyPaths: string[];
+
+  /** @internal */
+  constructor(realm: Realm, results: binding.Results, keyPaths: string[]) {
+    this.realm = realm;
+    this.results = results;
+    this.keyPaths = keyPaths;
+  }
+
+  /**
+   * Computes aggregates per group.
+   * @param spec - The aggregates to compute, by the name to return them under.
+   * @returns The keys and aggregates of the groups, as columns.
+   * @throws An {@link Error} if a key path doesn't exist or an aggregate doesn't apply to the type of its property.
+   * @example
+   * const { keys, values } = realm.objects(Order).groupBy(["customer.name", "day"]).aggregate({
+   *   total: ["sum", "amount"],
+   *   orders: ["count"],
+   * });
+   */
+  aggregate<Spec extends AggregateSpec>(spec: Spec): GroupedAggregates<Spec> {
+    const { names, operations, operands } = GroupBy.splitSpec(spec);
+    const result = binding.JsGroupBy.aggregate(this.realm.internal, this.results, this.keyPaths, operations, operands);
+    return this.fromBinding(names, result);
+  }
+
+  /**
+   * Like {@link GroupBy.aggregate}, but computes the aggregates on a background thread, over the objects of the
+   * collection when this is called.
+   * @param spec - The aggregates to compute, by the name to return them under.
+   * @returns A promise resolving to the keys and aggregates of the groups, as columns.
+   */
+  async aggregateAsync<Spec extends AggregateSpec>(spec: Spec): Promise<GroupedAggregates<Spec>> {
+    const { names, operations, operands } = GroupBy.splitSpec(spec);
+    const result = await binding.JsGroupBy.aggregateAsync(
+      this.realm.internal,
+      this.results,
+      this.keyPaths,
+      operations,
+      operands,
+    );
+    return this.fromBinding(names, result);
+  }
+
+  /** @internal */
+  private static splitSpec(spec: AggregateSpec) {
+    assert.object(spec, "spec", { allowArrays: false });
+    const names = Object.keys(spec);
+    const operations: string[] = [];
+    const operands: string[] = [];
+    for (const name of names) {
+      const aggregation = spec[name];
+      assert.array(aggregation, `aggregate '${name}'`);
+      const [operation, keyPath = ""] = aggregation;
+      assert(AGGREGATE_OPERATIONS.includes(operation), `Unexpected aggregate operation '${operation}'`);
+      assert.string(keyPath, `property of aggregate '${name}'`);
+      operations.push(operation);
+      operands.push(keyPath);
+    }
+    return { names, operations, operands };
+  }
+
+  /** @internal */
+  private fromBinding<Spec extends AggregateSpec>(
+    names: string[],
+    { keys, values }: binding.GroupedAggregates,
+  ): GroupedAggregates<Spec> {
+    const result: GroupedAggregates = { length: keys[0]?.length ?? values[0]?.length ?? 0, keys: {}, values: {} };
+    this.keyPaths.forEach((keyPath, index) => {
+      result.keys[keyPath] = keys[index].map(fromBindingValue) as GroupKey[];
+    });
+    names.forEach((name, index) => {
+      result.values[name] = values[index].map(fromBindingValue) as (number | Date | null)[];
+    });
+    return result as GroupedAggregates<Spec>;
+  }
+}
+
+function fromBindingValue(value: binding.MixedArg): unknown {
+  if (binding.Int64.isInt(value)) {
+    return binding.Int64.intToNum(value);
+  } else if (value instanceof binding.Float) {
+    return value.value;
+  } else if (value instanceof binding.Timestamp) {
+    return value.toDate();
+  } else {
+    return value;
+  }
+}
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { assert } from "./assert";
+import { getPrimitiveProperties } from "./ClassHelpers";
+import type { ClassHelpers } from "./ClassHelpers";
+
+/**
+ * The file format read by {@link Realm.importFrom}.
+ *
+ * `"ndjson"`
+ * : One JSON object per line, keyed by property name. Values may use Extended JSON, such as `{ "$oid": "..." }`.
+ *
+ * `"csv"`
+ * : Comma separated values with a header row of property names. Unquoted empty fields are read as null, and quoted
+ * empty fields as empty strings. Fields of `mixed` properties are read as Extended JSON, or as strings if they aren't.
+ *
+ * Text is accepted for any type of property, in the format written by {@link Results.exportTo}: ISO 8601 for dates,
+ * Base64 for data, and the string representation of object IDs, UUIDs and decimals.
+ * @since 12.16.0
+ */
+export type ImportFormat = "ndjson" | "csv";
+
+/**
+ * How {@link Realm.importFrom} handles records with the primary key of an existing object.
+ *
+ * `"insert"`
+ * : Count the record as an error.
+ *
+ * `"upsert"`
+ * : Update the properties of the existing object present in the record.
+ * @since 12.16.0
+ */
+export type ImportMode = "insert" | "upsert";
+
+/**
+ * Options for {@link Realm.importFrom}.
+ * @since 12.16.0
+ */
+export type ImportOptions = {
+  /** The default is `"ndjson"`. */
+  format?: ImportFormat;
+  /** The default is `"insert"`. */
+  mode?: ImportMode;
+  /** The number of records written per write transaction. The default is 10000. */
+  batchSize?: number;
+  /** Called with the number of records processed so far, after every batch. */
+  onProgress?: (processed: number) => void;
+};
+
+/**
+ * The outcome of {@link Realm.importFrom}.
+ * @since 12.16.0
+ */
+export type ImportResult = {
+  /** The number of objects created or updated. */
+  imported: number;
+  /** The number of records which could not be parsed or written. */
+  errors: number;
+  /** Describes the first 100 errors, with the line of the record. */
+  errorMessages: string[];
+};
+
+const DEFAULT_IMPORT_BATCH_SIZE = 10000;
+
+/** @internal */
+export async function importFrom(
+  realm: binding.Realm,
+  { objectSchema }: ClassHelpers,
+  path: string,
+  options: ImportOptions,
+): Promise<ImportResult> {
+  const { format = "ndjson", mode = "insert", batchSize = DEFAULT_IMPORT_BATCH_SIZE, onProgress } = options;
+  assert.string(path, "path");
+  assert(format === "ndjson" || format === "csv", `Unexpected import format: '${format}'`);
+  assert(mode === "insert" || mode === "upsert", `Unexpected import mode: '${mode}'`);
+  assert.integer(batchSize, "batchSize");
+  assert(batchSize > 0, "Expected 'batchSize' to be positive");
+  if (onProgress !== undefined) {
+    assert.function(onProgress, "onProgress");
+  }
+  const properties = getPrimitiveProperties(objectSchema);
+  const { imported, errors, errorMessages } = await binding.JsBulkImporter.importFrom(
+    realm,
+    path,
+    objectSchema.name,
+    format,
+    properties.map((property) => property.publicName || property.name),
+    properties.map((property) => property.name),
+    mode === "upsert",
+    batchSize,
+    onProgress ?? null,
+  );
+  return { imported, errors, errorMessages };
+}
@@ -187,6 +187,73 @@ export type LoggerCallback2 = (entry: LogEntry) => void;
  */
 export type LoggerCallback = LoggerCallback1 | LoggerCallback2;
 
+/**
+ * The format of lines written by a {@link LogSink}.
+ *
+ * `"text"`
+ * : One line per entry, e.g. `2024-01-31T12:34:56.789Z [Realm.Sync.Client] info: Connected`.
+ *
+ * `"json"`
+ * : One JSON object per line, with `time`, `category`, `level` and `message` properties.
+ * @since 12.16.0
+ */
+export type LogSinkFormat = "text" | "json";
+
+/**
+ * Appends log entries to a file, rotating it once it grows beyond a maximum size.
+ * When rotating, the file is renamed by appending `.1` to its path, previously rotated files are
+ * renamed from `.1` to `.2` and so on, and the oldest file is deleted.
+ * @since 12.16.0
+ */
+export type FileLogSink = {
+  type: "file";
+  /** Path of the file to append to. */
+  path: string;
+  /** The size in bytes at which the file is rotated, or `0` to never rotate it. The default is 10 MiB. */
+  maxFileSize?: number;
+  /** The number of rotated files to keep. The default is 5. */
+  maxFiles?: number;
+  /** The default is `"text"`. */
+  format?: LogSinkFormat;
+};
+
+/**
+ * Writes log entries to the standard error stream of the process.
+ * @since 12.16.0
+ */
+export type StderrLogSink = {
+  type: "stderr";
+  /** The default is `"text"`. */
+  format?: LogSinkFormat;
+};
+
+/**
+ * A logger implemented natively, which formats and writes log entries on a background thread,
+ * without involving the JavaScript thread. Useful to enable verbose logging without impacting the app.
+ * @since 12.16.0
+ */
+export type LogSink = FileLogSink | StderrLogSink;
+
+const DEFAULT_MAX_LOG_FILE_SIZE = 10 * 1024 * 1024;
+const DEFAULT_MAX_LOG_FILES = 5;
+
+/** @internal */
+export function toBindingLogSink(sink: LogSink): binding.Logger {
+  const { format = "text" } = sink;
+  assert(format === "text" || format === "json", `Unexpected log sink format: '${format}'`);
+  if (sink.type === "file") {
+    const { path, maxFileSize = DEFAULT_MAX_LOG_FILE_SIZE, maxFiles = DEFAULT_MAX_LOG_FILES } = sink;
+    assert.string(path, "path");
+    assert.integer(maxFileSize, "maxFileSize");
+    assert.integer(maxFiles, "maxFiles");
+    return binding.JsLogSinks.makeFileLogger(path, maxFileSize, maxFiles, format === "json");
+  } else if (sink.type === "stderr") {
+    return binding.JsLogSinks.makeStderrLogger(format === "json");
+  } else {
+    throw new Error(`Unexpected log sink type: '${(sink as { type: unknown }).type}'`);
+  }
+}
+
 /** @internal */
 export function toBindingLogger(logger: LoggerCallback) {
   if (isLoggerWithLevel(logger)) {
@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { assert } from "./assert";
+import type { Realm } from "./Realm";
+
+/**
+ * The space used by the objects of a single type.
+ */
+export type TableFileStats = {
+  objectType: string;
+  objectCount: number;
+  /** Bytes used by the objects of this type, including their indexes. */
+  bytes: number;
+};
+
+/**
+ * How the space of a Realm file is used.
+ * @see {@link Realm.fileStats}
+ */
+export type FileStats = {
+  /** The size of the file. */
+  totalBytes: number;
+  /** Bytes used by the data and history of the versions kept alive. */
+  usedBytes: number;
+  /** Bytes which are allocated in the file but not used, and which compaction would reclaim. */
+  freeBytes: number;
+  /** Bytes used by the history of changes needed by notifications and sync. */
+  historyBytes: number;
+  /** The version the {@link Realm} is currently at. */
+  version: number;
+  /** The number of versions kept alive by this and other Realm instances, which prevents reuse of their space. */
+  pinnedVersions: number;
+  /** The object types using the most space, in descending order. */
+  largestTables: TableFileStats[];
+};
+
+/**
+ * What the maintenance policy did, reported through {@link MaintenancePolicy.onEvent}.
+ */
+export type MaintenanceEvent =
+  | {
+      /** The file was compacted. */
+      type: "compacted";
+      before: FileStats;
+      after: FileStats;
+    }
+  | {
+      /** The file should have been compacted, but other instances of the Realm were open. */
+      type: "compactionSkipped";
+      stats: FileStats;
+    }
+  | {
+      /**
+       * More versions than {@link MaintenancePolicy.maxPinnedVersions} are kept alive, typically by frozen objects
+       * or by other threads or processes which are not refreshing. The space of these versions cannot be reused,
+       * so the file keeps growing until they are released.
+       */
+      type: "pinnedVersions";
+      stats: FileStats;
+    }
+  | {
+      /** Checking or compacting the file failed. */
+      type: "error";
+      error: unknown;
+    };
+
+/**
+ * An opt-in policy for compacting the Realm file while the app is not writing to it.
+ * @see {@link Realm.startMaintenance}
+ */
+export type MaintenancePolicy = {
+  /** How often to check the file statistics. Defaults to 60 seconds. */
+  checkIntervalMs?: number;
+  /**
+   * The file is only compacted if it is at least this big. Defaults to 10 MiB.
+   */
+  minTotalBytes?: number;
+  /**
+   * The file is only compacted if at least this fraction of it is free. Defaults to 0.5.
+   */
+  minFreeRatio?: number;
+  /**
+   * Report a `"pinnedVersions"` event if more versions than this are kept alive. Defaults to 50.
+   */
+  maxPinnedVersions?: number;
+  /**
+   * Decides if the file should be compacted, instead of {@link minTotalBytes} and {@link minFreeRatio}.
+   */
+  shouldCompact?: (stats: FileStats) => boolean;
+  /** Called with what was done, after each check where something was done. */
+  onEvent?: (event: MaintenanceEvent) => void;
+};
+
+const DEFAULT_CHECK_INTERVAL_MS = 60_000;
+const DEFAULT_MIN_TOTAL_BYTES = 10 * 1024 * 1024;
+const DEFAULT_MIN_FREE_RATIO = 0.5;
+const DEFAULT_MAX_PINNED_VERSIONS = 50;
+
+/** @internal */
+export function getFileStats(realm: binding.Realm, maxTables: number): FileStats {
+  const stats = binding.JsFileStats.getFileStats(realm, maxTables);
+  return {
+    totalBytes: stats.totalBytes,
+    usedBytes: stats.usedBytes,
+    freeBytes: stats.freeBytes,
+    historyBytes: stats.historyBytes,
+    version: stats.version,
+    pinnedVersions: stats.numberOfVersions,
+    largestTables: stats.largestTables.map(({ objectType, objectCount, byteSize }) => ({
+      objectType,
+      objectCount,
+      bytes: byteSize,
+    })),
+  };
+}
+
+/** @internal */
+export function validateMaintenancePolicy(policy: unknown): asserts policy is MaintenancePolicy {
+  assert.object(policy, "maintenance policy", { allowArrays: false });
+  const { checkIntervalMs, minTotalBytes, minFreeRatio, maxPinnedVersions, shouldCompact, onEvent } = policy;
+  if (checkIntervalMs !== undefined) {
+    assert.number(checkIntervalMs, "'checkIntervalMs' on maintenance policy");
+    assert(checkIntervalMs > 0, "'checkIntervalMs' on maintenance policy must be greater than zero.");
+  }
+  if (minTotalBytes !== undefined) {
+    assert.number(minTotalBytes, "'minTotalBytes' on maintenance policy");
+  }
+  if (minFreeRatio !== undefined) {
+    assert.number(minFreeRatio, "'minFreeRatio' on maintenance policy");
+    assert(minFreeRatio >= 0 && minFreeRatio <= 1, "'minFreeRatio' on maintenance policy must be between 0 and 1.");
+  }
+  if (maxPinnedVersions !== undefined) {
+    assert.number(maxPinnedVersions, "'maxPinnedVersions' on maintenance policy");
+  }
+  if (shouldCompact !== undefined) {
+    assert.function(shouldCompact, "'shouldCompact' on maintenance policy");
+  }
+  if (onEvent !== undefined) {
+    assert.function(onEvent, "'onEvent' on maintenance policy");
+  }
+}
+
+/**
+ * Periodically checks the file statistics of a Realm and compacts it when the thresholds of the policy are crossed.
+ * Checks only act when the Realm has been idle since the previous check, i.e. when no version was committed in the
+ * meantime and it's not in a write transaction, to stay out of the way of the app.
+ * @internal
+ */
+export class MaintenanceScheduler {
+  private timer: ReturnType<typeof setTimeout> | null = null;
+  private stopped = false;
+  private lastVersion = -1;
+
+  constructor(private readonly realm: Realm, private readonly policy: MaintenancePolicy) {}
+
+  start(): void {
+    this.schedule();
+  }
+
+  stop(): void {
+    this.stopped = true;
+    if (this.timer !== null) {
+      clearTimeout(this.timer);
+      this.timer = null;
+    }
+  }
+
+  /**
+   * Runs a single check right away.
+   * @returns A promise of the events reported by the check, which resolves once the file is compacted.
+   */
+  async check(): Promise<MaintenanceEvent[]> {
+    const events: MaintenanceEvent[] = [];
+    try {
+      await this.runCheck(events);
+    } catch (error) {
+      events.push({ type: "error", error });
+    }
+    for (const event of events) {
+      this.policy.onEvent?.(event);
+    }
+    return events;
+  }
+
+  private schedule(): void {
+    this.timer = setTimeout(() => {
+      this.timer = null;
+      if (this.realm.isClosed) {
+        return;
+      }
+      // The next check is scheduled once this one is done, as compacting a big file can take longer than the interval.
+      this.check().finally(() => {
+        if (!this.stopped) {
+          this.schedule();
+        }
+      });
+    }, this.policy.checkIntervalMs ?? DEFAULT_CHECK_INTERVAL_MS);
+    // Don't keep a Node.js process alive just for maintenance.
+    (this.timer as { unref?: () => void }).unref?.();
+  }
+
+  private async runCheck(events: MaintenanceEvent[]): Promise<void> {
+    const { realm, policy } = this;
+    if (realm.isClosed || realm.isInTransaction || realm.isCompacting) {
+      return;
+    }
+    const stats = getFileStats(realm.internal, 0);
+    const idle = stats.version === this.lastVersion;
+    this.lastVersion = stats.version;
+
+    if (stats.pinnedVersions > (policy.maxPinnedVersions ?? DEFAULT_MAX_PINNED_VERSIONS)) {
+      events.push({ type: "pinnedVersions", stats });
+    }
+    if (!idle || !this.shouldCompact(stats)) {
+      return;
+    }
+    // Compacting on a background thread, as the checks run while the app is otherwise using the JS thread.
+    const compacted = await realm.compactAsync();
+    if (realm.isClosed) {
+      return;
+    }
+    if (compacted) {
+      const after = getFileStats(realm.internal, 0);
+      this.lastVersion = after.version;
+      events.push({ type: "compacted", before: stats, after });
+    } else {
+      events.push({ type: "compactionSkipped", stats });
+    }
+  }
+
+  private shouldCompact(stats: FileStats): boolean {
+    const {
+      shouldCompact,
+      minTotalBytes = DEFAULT_MIN_TOTAL_BYTES,
+      minFreeRatio = DEFAULT_MIN_FREE_RATIO,
+    } = this.policy;
+    if (shouldCompact) {
+      return shouldCompact(stats);
+    }
+    return stats.totalBytes >= minTotalBytes && stats.freeBytes >= stats.totalBytes * minFreeRatio;
+  }
+}
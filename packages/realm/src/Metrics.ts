@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import type { binding } from "./binding";
+
+/**
+ * A histogram of durations.
+ */
+export type LatencyHistogram = {
+  /** The number of recorded durations. */
+  count: number;
+  /** The sum of all recorded durations, in milliseconds. */
+  totalMs: number;
+  /** The longest recorded duration, in milliseconds. */
+  maxMs: number;
+  /** Entry `i` counts the durations between 2^i and 2^(i+1) nanoseconds. The last entry also counts anything longer. */
+  buckets: number[];
+};
+
+/**
+ * Metrics recorded by a {@link Realm} instance since it was opened or since {@link Realm.resetMetrics} was last called.
+ * @see {@link Realm.metrics}
+ */
+export type RealmMetrics = {
+  /** Time spent beginning write transactions, which is dominated by waiting for the write lock. */
+  writeLockWait: LatencyHistogram;
+  /** Time spent committing write transactions. */
+  commit: LatencyHistogram;
+  /** Bytes written to the file by committed write transactions. */
+  commitBytes: {
+    total: number;
+    last: number;
+    max: number;
+  };
+  /** Time spent in change listeners on collections, keyed by object type or `"(values)"` for collections of primitive values. */
+  notificationCallbacks: Record<string, LatencyHistogram>;
+  /** The current version of the Realm and the number of versions kept alive by this and other Realm instances. */
+  versions: {
+    current: number;
+    pinned: number;
+  };
+  /** The size of the Realm file in bytes, or 0 for in-memory Realms. */
+  fileSize: number;
+};
+
+function fromBindingHistogram({ count, totalMs, maxMs, buckets }: binding.LatencyHistogramSnapshot): LatencyHistogram {
+  return { count, totalMs, maxMs, buckets };
+}
+
+/** @internal */
+export function fromBindingMetrics(snapshot: binding.RealmMetricsSnapshot): RealmMetrics {
+  return {
+    writeLockWait: fromBindingHistogram(snapshot.writeLockWait),
+    commit: fromBindingHistogram(snapshot.commit),
+    commitBytes: {
+      total: snapshot.commitBytesTotal,
+      last: snapshot.commitBytesLast,
+      max: snapshot.commitBytesMax,
+    },
+    notificationCallbacks: Object.fromEntries(
+      Object.entries(snapshot.notificationCallbacks).map(([collection, histogram]) => [
+        collection,
+        fromBindingHistogram(histogram),
+      ]),
+    ),
+    versions: {
+      current: snapshot.version,
+      pinned: snapshot.numberOfVersions,
+    },
+    fileSize: snapshot.fileSize,
+  };
+}
@@ -40,6 +40,8 @@ import type { TypeHelpers } from "./TypeHelpers";
 import { flags } from "./flags";
 import { OBJECT_HELPERS, OBJECT_INTERNAL, OBJECT_REALM } from "./symbols";
 import { createResultsAccessor } from "./collection-accessors/Results";
+import { toArrayBuffer } from "./type-helpers/array-buffer";
+import { expandMixedTree } from "./property-accessors/mixed-tree";
 
 /**
  * The update mode to use when creating an object that already exists,
@@ -80,6 +82,12 @@ export type AnyRealmObject = RealmObject<any>;
 
 export const KEY_ARRAY = Symbol("Object#keys");
 export const KEY_SET = Symbol("Object#keySet");
+/**
+ * A chunk of a value written by {@link RealmObject.writeBytes}: bytes or a string, which is written as UTF-8.
+ * @since 12.16.0
+ */
+export type BytesChunk = ArrayBuffer | ArrayBufferView | string;
+
 const INTERNAL_LISTENERS = Symbol("Object#listeners");
 const DEFAULT_PROPERTY_DESCRIPTOR: PropertyDescriptor = { configurable: true, enumerable: true, writable: true };
 
@@ -540,6 +548,121 @@ export class RealmObject<T = DefaultObject, RequiredProperties extends keyof Omi
     this[INTERNAL_LISTENERS]?.removeAllListeners();
   }
 
+  /**
+   * Read the value of a `mixed` property as plain JS values, reading nested lists and dictionaries as arrays and
+   * objects. The whole tree is read natively in a single call, whereas the lists and dictionaries returned by the
+   * property are read an item at a time.
+   * @param propertyName - The name of the property.
+   * @throws An {@link Error} if the property doesn't exist or isn't a `mixed` property.
+   * @returns A copy of the value, which doesn't update when the property changes.
+   * @since 12.16.0
+   */
+  getPlainValue(propertyName: string): unknown {
+    assert.string(propertyName, "propertyName");
+    const { properties } = this[OBJECT_REALM].getClassHelpers(this);
+    const { type, objectType, columnKey, fromBinding } = properties.get(propertyName);
+    const typeName = getTypeName(type, objectType);
+    assert(typeName === "mixed", `Expected '${propertyName}' to be a 'mixed' property, got '${typeName}'`);
+    return expandMixedTree(binding.JsMixedTree.read(this[OBJECT_INTERNAL], columnKey), fromBinding);
+  }
+
+  /**
+   * Get the size in bytes of the value of a `data` or `string` property, which is the UTF-8 encoded length for
+   * strings and 0 for null values. Useful to page through a large value with {@link RealmObject.readBytes}.
+   * This and the other methods reading and writing bytes are static, as the methods of an object share their
+   * namespace with its properties, such as a `byteLength` property of an attachment.
+   * @param object - The object to read from.
+   * @param propertyName - The name of the property.
+   * @throws An {@link Error} if the property doesn't exist or isn't a `data` or `string` property.
+   * @returns The size of the value in bytes.
+   * @since 12.16.0
+   */
+  static byteLength(object: AnyRealmObject, propertyName: string): number {
+    assert.instanceOf(object, RealmObject, "object");
+    return binding.JsObjBytes.byteLength(object[OBJECT_INTERNAL], getBytesColumn(object, propertyName));
+  }
+
+  /**
+   * Read a range of the bytes of a `data` or `string` property, without reading the rest of the value into JS.
+   * Strings are read as their UTF-8 bytes and null values as empty.
+   * @param object - The object to read from.
+   * @param propertyName - The name of the property.
+   * @param offset - The position of the first byte to read. The default is 0.
+   * @param length - The maximum number of bytes to read. The default is the rest of the value.
+   * @throws An {@link Error} if the property doesn't exist or isn't a `data` or `string` property.
+   * @returns The bytes read, which are fewer than `length` if the value ends before.
+   * @since 12.16.0
+   * @example
+   * const header = new Uint8Array(Realm.Object.readBytes(attachment, "content", 0, 16));
+   */
+  static readBytes(object: AnyRealmObject, propertyName: string, offset = 0, length?: number): ArrayBuffer {
+    assert.instanceOf(object, RealmObject, "object");
+    assert.integer(offset, "offset");
+    assert(offset >= 0, "Expected 'offset' to be non-negative");
+    const column = getBytesColumn(object, propertyName);
+    const obj = object[OBJECT_INTERNAL];
+    if (length === undefined) {
+      length = Math.max(binding.JsObjBytes.byteLength(obj, column) - offset, 0);
+    } else {
+      assert.integer(length, "length");
+      assert(length >= 0, "Expected 'length' to be non-negative");
+    }
+    return binding.JsObjBytes.read(obj, column, offset, length);
+  }
+
+  /**
+   * Set the value of a `data` or `string` property from a sequence of chunks, which are collected natively
+   * such that the whole value is never held in JS. String chunks are written as UTF-8.
+   * @param object - The object to write to.
+   * @param propertyName - The name of the property.
+   * @param chunks - The chunks of the value, in order.
+   * @throws An {@link Error} if not inside a write transaction, or if the property doesn't exist or isn't a `data`
+   * or `string` property.
+   * @returns The size of the value written, in bytes.
+   * @since 12.16.0
+   */
+  static writeBytes(object: AnyRealmObject, propertyName: string, chunks: Iterable<BytesChunk>): number {
+    assert.instanceOf(object, RealmObject, "object");
+    assert.inTransaction(object[OBJECT_REALM]);
+    const column = getBytesColumn(object, propertyName);
+    const writer = binding.BytesWriter.make();
+    for (const chunk of chunks) {
+      appendChunk(writer, chunk);
+    }
+    const size = writer.size();
+    writer.commit(object[OBJECT_INTERNAL], column);
+    return size;
+  }
+
+  /**
+   * Set the value of a `data` or `string` property from a sequence of chunks produced asynchronously, such as a
+   * Node.js readable stream. The chunks are collected natively as they arrive, and the value is set in a write
+   * transaction of its own once the sequence ends.
+   * @param object - The object to write to.
+   * @param propertyName - The name of the property.
+   * @param chunks - The chunks of the value, in order.
+   * @throws An {@link Error} if the property doesn't exist or isn't a `data` or `string` property.
+   * @returns A promise resolving to the size of the value written, in bytes.
+   * @since 12.16.0
+   * @example
+   * await Realm.Object.writeBytesAsync(attachment, "content", fs.createReadStream(path));
+   */
+  static async writeBytesAsync(
+    object: AnyRealmObject,
+    propertyName: string,
+    chunks: AsyncIterable<BytesChunk> | Iterable<BytesChunk>,
+  ): Promise<number> {
+    assert.instanceOf(object, RealmObject, "object");
+    const column = getBytesColumn(object, propertyName);
+    const writer = binding.BytesWriter.make();
+    for await (const chunk of chunks) {
+      appendChunk(writer, chunk);
+    }
+    const size = writer.size();
+    object[OBJECT_REALM].write(() => writer.commit(object[OBJECT_INTERNAL], column));
+    return size;
+  }
+
   /**
    * Get underlying type of a property value.
    * @param propertyName - The name of the property to retrieve the type of.
@@ -596,6 +719,26 @@ export class RealmObject<T = DefaultObject, RequiredProperties extends keyof Omi
   }
 }
 
+function getBytesColumn(object: RealmObject, propertyName: string): binding.ColKey {
+  assert.string(propertyName, "propertyName");
+  const { properties } = object[OBJECT_REALM].getClassHelpers(object);
+  const { type, objectType, columnKey } = properties.get(propertyName);
+  const typeName = getTypeName(type, objectType);
+  assert(
+    typeName === "data" || typeName === "string",
+    `Expected '${propertyName}' to be a 'data' or 'string' property, got '${typeName}'`,
+  );
+  return columnKey;
+}
+
+function appendChunk(writer: binding.BytesWriter, chunk: BytesChunk) {
+  if (typeof chunk === "string") {
+    writer.appendString(chunk);
+  } else {
+    writer.append(toArrayBuffer(chunk, false));
+  }
+}
+
 // We like to refer to this as "Realm.Object"
 // TODO: Determine if we want to revisit this if we're going away from a namespaced API
 Object.defineProperty(RealmObject, "name", { value: "Realm.Object" });
@@ -29,6 +29,7 @@ import { RealmObject } from "./Object";
 import { type TypeHelpers, toItemType } from "./TypeHelpers";
 import { getTypeName } from "./schema";
 import { unwind } from "./ranges";
+import { addCoalescedNotificationCallback } from "./CoalescedNotifications";
 import type { Realm } from "./Realm";
 import { mixedToBinding } from "./type-helpers/Mixed";
 import { OBJECT_INTERNAL } from "./symbols";
@@ -57,6 +58,23 @@ export type OrderedCollectionAccessor<T = unknown> = ListAccessor<T> | ResultsAc
  */
 export type SortDescriptor = string | [string, boolean];
 
+/**
+ * Matches queries which sort or make the results distinct. Text within string literals may match too, which is fine
+ * as it only makes paging slower.
+ */
+const SORT_OR_DISTINCT = /\b(SORT|DISTINCT)\s*\(/i;
+
+/**
+ * How the items of a collection are ordered, as far as paging through it by value needs to know.
+ * @internal
+ */
+export type CollectionOrder = {
+  /** The key paths the collection is sorted by and whether ascending, the first taking precedence. */
+  descriptors: [string, boolean][];
+  /** Whether items which are equal by the descriptors are ordered by key, as in results of a table. */
+  byKey: boolean;
+};
+
 export type CollectionChangeSet = {
   /**
    * The indices in the collection where objects were inserted.
@@ -74,6 +92,16 @@ export type CollectionChangeSet = {
    * The indices in the old state of the collection where objects were modified.
    */
   oldModifications: number[];
+  /**
+   * The keys of the deleted, inserted and modified objects, in the same order as their indices.
+   * Only present if the listener was added with {@link CollectionListenerOptions.objectKeys}.
+   * @since 12.16.0
+   */
+  objectKeys?: {
+    deletions: string[];
+    insertions: string[];
+    newModifications: string[];
+  };
 };
 
 export type CollectionChangeCallback<T = unknown, EntryType extends [unknown, unknown] = [unknown, unknown]> = (
@@ -176,26 +204,72 @@ export abstract class OrderedCollection<
     if (arguments.length === 0) {
       throw new IllegalConstructorError("OrderedCollection");
     }
-    super(accessor, typeHelpers, (callback, keyPaths) => {
-      return results.addNotificationCallback(
-        (changes) => {
+    super(accessor, typeHelpers, (callback, keyPaths, { objectKeys, minIntervalMs, maxDelayMs }) => {
+      const { metricsRecorder, sharedQueries } = realm;
+      // Collections of primitive values have no object type to attribute their listeners to
+      const metricsName = results.objectType || "(values)";
+      // Created on the first notification, which is delivered for the version the tracker should start from
+      let keyTracker: binding.CollectionKeyTracker | null = null;
+      const deliver = (changeSet: CollectionChangeSet) => {
+        metricsRecorder.willInvokeCallback();
+        const { slowQueryLog } = realm;
+        const start = slowQueryLog ? performance.now() : 0;
+        try {
+          if (objectKeys && results.objectType) {
+            if (keyTracker) {
+              const keys = keyTracker.apply(
+                results,
+                changeSet.deletions,
+                changeSet.insertions,
+                changeSet.newModifications,
+              );
+              changeSet.objectKeys = {
+                deletions: keys.deletions,
+                insertions: keys.insertions,
+                newModifications: keys.modifications,
+              };
+            } else {
+              keyTracker = binding.CollectionKeyTracker.make(results);
+              changeSet.objectKeys = { deletions: [], insertions: [], newModifications: [] };
+            }
+          }
+          callback(proxied, changeSet);
+        } catch (err) {
+          // Scheduling a throw on the event loop,
+          // since throwing synchronously here would result in an abort in the calling C++
+          setImmediate(() => {
+            throw err;
+          });
+        } finally {
+          metricsRecorder.didInvokeCallback(metricsName);
           try {
-            callback(proxied, {
-              deletions: unwind(changes.deletions),
-              insertions: unwind(changes.insertions),
-              oldModifications: unwind(changes.modifications),
-              newModifications: unwind(changes.modificationsNew),
-            });
+            slowQueryLog?.record("listener", results, performance.now() - start);
           } catch (err) {
-            // Scheduling a throw on the event loop,
-            // since throwing synchronously here would result in an abort in the calling C++
+            // The onSlowQuery callback is called from here too, so its errors are thrown on the event loop as well
             setImmediate(() => {
               throw err;
             });
           }
-        },
-        keyPaths ? this.mapKeyPaths(keyPaths) : keyPaths,
-      );
+        }
+      };
+      const deliverChanges = (changes: binding.CollectionChangeSet) =>
+        deliver({
+          deletions: unwind(changes.deletions),
+          insertions: unwind(changes.insertions),
+          oldModifications: unwind(changes.modifications),
+          newModifications: unwind(changes.modificationsNew),
+        });
+      const mappedKeyPaths = keyPaths ? this.mapKeyPaths(keyPaths) : keyPaths;
+      if (minIntervalMs !== undefined) {
+        return addCoalescedNotificationCallback(results, mappedKeyPaths, deliverChanges, {
+          minIntervalMs,
+          maxDelayMs: maxDelayMs ?? minIntervalMs,
+        });
+      }
+      if (sharedQueries && !keyPaths && !objectKeys) {
+        return sharedQueries.subscribe(results, deliver);
+      }
+      return results.addNotificationCallback(deliverChanges, mappedKeyPaths);
     });
     // Wrap in a proxy to trap ownKeys and get, enabling the spread operator
     const proxied = new Proxy(this, PROXY_HANDLER as ProxyHandler<this>);
@@ -228,6 +302,12 @@ export abstract class OrderedCollection<
       writable: false,
       value: mixedToBinding.bind(undefined, realm.internal),
     });
+    Object.defineProperty(this, "order", {
+      enumerable: false,
+      configurable: false,
+      writable: true,
+      value: { descriptors: [], byKey: false },
+    });
     // See https://tc39.es/ecma262/multipage/indexed-collections.html#sec-array.prototype-@@unscopables
     Object.defineProperty(this, Symbol.unscopables, {
       enumerable: false,
@@ -242,6 +322,8 @@ export abstract class OrderedCollection<
   protected declare classHelpers: ClassHelpers | null;
   /** @internal */
   private declare mixedToBinding: (value: unknown, options: { isQueryArg: boolean }) => binding.MixedArg;
+  /** @internal */
+  public declare order: CollectionOrder;
 
   /**
    * Get an element of the collection.
@@ -716,7 +798,7 @@ export abstract class OrderedCollection<
    */
   min(property?: string): number | Date | undefined {
     const columnKey = this.getPropertyColumnKey(property);
-    const result = this.results.min(columnKey);
+    const result = this.measureAggregate("min", property, () => this.results.min(columnKey));
     if (result instanceof Date || typeof result === "number" || typeof result === "undefined") {
       return result;
     } else if (binding.Int64.isInt(result)) {
@@ -743,7 +825,7 @@ export abstract class OrderedCollection<
    */
   max(property?: string): number | Date | undefined {
     const columnKey = this.getPropertyColumnKey(property);
-    const result = this.results.max(columnKey);
+    const result = this.measureAggregate("max", property, () => this.results.max(columnKey));
     if (result instanceof Date || typeof result === "number" || typeof result === "undefined") {
       return result;
     } else if (binding.Int64.isInt(result)) {
@@ -770,7 +852,7 @@ export abstract class OrderedCollection<
    */
   sum(property?: string): number {
     const columnKey = this.getPropertyColumnKey(property);
-    const result = this.results.sum(columnKey);
+    const result = this.measureAggregate("sum", property, () => this.results.sum(columnKey));
     if (typeof result === "number") {
       return result;
     } else if (binding.Int64.isInt(result)) {
@@ -795,7 +877,7 @@ export abstract class OrderedCollection<
    */
   avg(property?: string): number | undefined {
     const columnKey = this.getPropertyColumnKey(property);
-    const result = this.results.average(columnKey);
+    const result = this.measureAggregate("avg", property, () => this.results.average(columnKey));
     if (typeof result === "number" || typeof result === "undefined") {
       return result;
     } else if (binding.Int64.isInt(result)) {
@@ -807,6 +889,14 @@ export abstract class OrderedCollection<
     }
   }
 
+  /** @internal */
+  private measureAggregate<R>(name: string, property: string | undefined, compute: () => R): R {
+    const { slowQueryLog } = this.realm;
+    return slowQueryLog
+      ? slowQueryLog.measure("aggregate", this.results, compute, `${name}(${property ?? ""})`)
+      : compute();
+  }
+
   /**
    * Returns new {@link Results} that represent this collection being filtered by the provided query.
    * @param queryString - Query used to filter objects from the collection.
@@ -823,12 +913,19 @@ export abstract class OrderedCollection<
     const kpMapping = binding.Helpers.getKeypathMapping(realm.internal);
     const bindingArgs = args.map((arg) => this.queryArgToBinding(arg));
     const newQuery = parent.query.table.query(queryString, bindingArgs, kpMapping);
-    const results = binding.Helpers.resultsAppendQuery(parent, newQuery);
+    const appended = binding.Helpers.resultsAppendQuery(parent, newQuery);
+    const results = realm.sharedQueries?.share(parent, appended) ?? appended;
+    // Run the query now rather than when the results are first read, to time it.
+    realm.slowQueryLog?.measure("filter", results, () => results.size());
 
     const itemType = toItemType(results.type);
     const typeHelpers = this[TYPE_HELPERS];
     const accessor = createResultsAccessor({ realm, typeHelpers, itemType });
-    return new indirect.Results(realm, results, accessor, typeHelpers);
+    const filtered = new indirect.Results(realm, results, accessor, typeHelpers);
+    // Sorting or making the results distinct in the query reorders them in ways which aren't tracked here.
+    // Keys are then unordered too, which makes paging scan for the object of a cursor, as for any unknown order.
+    filtered.order = SORT_OR_DISTINCT.test(queryString) ? { descriptors: [], byKey: false } : this.order;
+    return filtered;
   }
 
   /** @internal */
@@ -914,11 +1011,16 @@ export abstract class OrderedCollection<
         }
       });
       // TODO: Call `parent.sort`, avoiding property name to column key conversion to speed up performance here.
-      const results = parent.sortByNames(descriptors);
+      const sorted = parent.sortByNames(descriptors);
+      const results = realm.sharedQueries?.share(parent, sorted) ?? sorted;
+      realm.slowQueryLog?.measure("sort", results, () => results.size());
       const itemType = toItemType(results.type);
       const typeHelpers = this[TYPE_HELPERS];
       const accessor = createResultsAccessor({ realm, typeHelpers, itemType });
-      return new indirect.Results(realm, results, accessor, typeHelpers);
+      const sortedResults = new indirect.Results(realm, results, accessor, typeHelpers);
+      // Sorting again takes precedence over the previous sorting, which breaks ties
+      sortedResults.order = { descriptors: [...descriptors, ...this.order.descriptors], byKey: this.order.byKey };
+      return sortedResults;
     } else if (typeof arg0 === "string") {
       return this.sorted([[arg0, arg1 === true]]);
     } else if (typeof arg0 === "boolean") {
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+import { binding } from "./binding";
+import { assert } from "./assert";
+import { BSON } from "./bson";
+
+/**
+ * Options for {@link Results.page}.
+ * @since 12.16.0
+ */
+export type PageOptions = {
+  /** The cursor of the previous page, or nothing to get the first page. */
+  after?: string | null;
+  /** The maximum number of objects in the page. */
+  limit: number;
+};
+
+/**
+ * A page of objects returned by {@link Results.page}.
+ * @since 12.16.0
+ */
+export type Page<T> = {
+  /** The objects in the page, in the order of the results. */
+  items: T[];
+  /**
+   * The cursor to pass as `after` to get the next page, which refers to the last object of this page.
+   * This is the cursor the page was requested with if the page is empty.
+   */
+  cursor: string | null;
+  /** Whether there were more objects after this page when it was read. */
+  hasMore: boolean;
+};
+
+/**
+ * The position of an object in results, by the values it's sorted by and its key.
+ * @internal
+ */
+export type Cursor = {
+  values: binding.MixedArg[];
+  key: binding.Int64;
+};
+
+type EncodedValue =
+  | null
+  | string
+  | number
+  | boolean
+  | { int: string }
+  | { float: number }
+  | { date: [string, number] }
+  | { oid: string }
+  | { uuid: string }
+  | { decimal: string };
+
+/** @internal */
+export function encodeCursor({ values, key }: Cursor): string {
+  return JSON.stringify({ key: key.toString(), values: values.map(encodeValue) });
+}
+
+/** @internal */
+export function decodeCursor(cursor: string): Cursor {
+  assert.string(cursor, "cursor");
+  let decoded: { key: string; values: EncodedValue[] };
+  try {
+    decoded = JSON.parse(cursor);
+    assert.string(decoded.key);
+    assert.array(decoded.values);
+  } catch {
+    throw new Error(`Invalid page cursor: '${cursor}'`);
+  }
+  return { key: binding.Int64.strToInt(decoded.key), values: decoded.values.map(decodeValue) };
+}
+
+function encodeValue(value: binding.MixedArg): EncodedValue {
+  if (value === null || typeof value === "string" || typeof value === "number" || typeof value === "boolean") {
+    return value;
+  } else if (binding.Int64.isInt(value)) {
+    return { int: value.toString() };
+  } else if (value instanceof binding.Float) {
+    return { float: value.value };
+  } else if (value instanceof binding.Timestamp) {
+    return { date: [value.seconds.toString(), value.nanoseconds] };
+  } else if (value instanceof BSON.ObjectId) {
+    return { oid: value.toHexString() };
+  } else if (value instanceof BSON.UUID) {
+    return { uuid: value.toHexString() };
+  } else if (value instanceof BSON.Decimal128) {
+    return { decimal: value.toString() };
+  } else {
+    throw new Error(
+      "Only results sorted by numbers, strings, booleans, dates, object ids, UUIDs and decimals can be paged",
+    );
+  }
+}
+
+function decodeValue(value: EncodedValue): binding.MixedArg {
+  if (value === null || typeof value !== "object") {
+    return value;
+  } else if ("int" in value) {
+    return binding.Int64.strToInt(value.int);
+  } else if ("float" in value) {
+    return new binding.Float(value.float);
+  } else if ("date" in value) {
+    return binding.Timestamp.make(binding.Int64.strToInt(value.date[0]), value.date[1]);
+  } else if ("oid" in value) {
+    return new BSON.ObjectId(value.oid);
+  } else if ("uuid" in value) {
+    return new BSON.UUID(value.uuid);
+  } else {
+    return BSON.Decimal128.fromString(value.decimal);
+  }
+}
@@ -33,6 +33,8 @@ import {
   type ObjectSchema,
   type PresentationPropertyTypeName,
   type RealmObjectConstructor,
+  SCHEMA_FINGERPRINT_SUFFIX,
+  SchemaFingerprint,
   fromBindingRealmSchema,
   normalizeObjectSchema,
   normalizeRealmSchema,
@@ -48,11 +50,13 @@ import {
   LOG_CATEGORIES,
   type LogCategory,
   type LogLevel,
+  type LogSink,
   type LoggerCallback,
   type LoggerCallback1,
   type LoggerCallback2,
   defaultLogger,
   defaultLoggerLevel,
+  toBindingLogSink,
   toBindingLogger,
   toBindingLoggerLevel,
 } from "./Logger";
@@ -66,6 +70,20 @@ import type { TypeHelpers } from "./TypeHelpers";
 import { toArrayBuffer } from "./type-helpers/array-buffer";
 import { OBJECT_INTERNAL, OBJECT_REALM } from "./symbols";
 import { createResultsAccessor } from "./collection-accessors/Results";
+import { type RealmMetrics, fromBindingMetrics } from "./Metrics";
+import { type TracingOptions, isTracing, startTracing, stopTracing } from "./Tracing";
+import {
+  type FileStats,
+  type MaintenancePolicy,
+  MaintenanceScheduler,
+  getFileStats,
+  validateMaintenancePolicy,
+} from "./Maintenance";
+import { type ImportOptions, type ImportResult, importFrom } from "./Import";
+import { type ChangesSince, getChangesSince } from "./ChangeFeed";
+import { runInScope } from "./Scope";
+import { SlowQueryLog, type SlowQueryLogOptions, validateSlowQueryLogOptions } from "./SlowQueryLog";
+import { SharedQueries } from "./SharedQueries";
 
 const debug = extendDebug("Realm");
 
@@ -117,10 +135,32 @@ export class Realm {
    * @example
    * Realm.setLogLevel("all");
    */
-  static setLogLevel(level: LogLevel, category: LogCategory = "Realm"): void {
+  static setLogLevel(level: LogLevel, category?: LogCategory): void;
+
+  /**
+   * Sets the log levels of multiple categories at once.
+   * @param levels - The log level to use per category. Categories not mentioned are left unchanged.
+   * @since 12.16.0
+   * @example
+   * Realm.setLogLevel({ "Realm": "warn", "Realm.Sync.Client": "trace" });
+   */
+  static setLogLevel(levels: Partial<Record<LogCategory, LogLevel>>): void;
+
+  static setLogLevel(arg: LogLevel | Partial<Record<LogCategory, LogLevel>>, category: LogCategory = "Realm"): void {
+    if (typeof arg === "object") {
+      // Parent categories are applied first, as their level propagates to subcategories
+      const categories = Object.keys(arg).sort() as LogCategory[];
+      for (const category of categories) {
+        const level = arg[category];
+        if (level) {
+          Realm.setLogLevel(level, category);
+        }
+      }
+      return;
+    }
     assert(LOG_CATEGORIES.includes(category as LogCategory), `Unexpected log category: '${category}'`);
     const categoryRef = binding.LogCategoryRef.getCategory(category);
-    categoryRef.setDefaultLevelThreshold(toBindingLoggerLevel(level));
+    categoryRef.setDefaultLevelThreshold(toBindingLoggerLevel(arg));
   }
 
   /**
@@ -148,9 +188,67 @@ export class Realm {
    */
   static setLogger(loggerCallback: LoggerCallback1): void;
 
-  static setLogger(loggerCallback: LoggerCallback) {
-    assert.function(loggerCallback);
-    binding.Logger.setDefaultLogger(toBindingLogger(loggerCallback));
+  /**
+   * Sets a native logger, which writes log entries from a background thread without involving the JavaScript thread.
+   * Use {@link Realm.setLogLevel} to control the log level per category, as with any other logger.
+   * @param sink - The destination and format of the log entries.
+   * @note The logger needs to be set up before opening the first Realm.
+   * @since 12.16.0
+   * @example
+   * Realm.setLogger({ type: "file", path: "realm.log", format: "json" });
+   * Realm.setLogLevel("trace", "Realm.Sync");
+   */
+  static setLogger(sink: LogSink): void;
+
+  static setLogger(arg: LoggerCallback | LogSink) {
+    if (typeof arg === "object" && arg !== null) {
+      binding.Logger.setDefaultLogger(toBindingLogSink(arg));
+    } else {
+      assert.function(arg);
+      binding.Logger.setDefaultLogger(toBindingLogger(arg));
+    }
+  }
+
+  /**
+   * Keep up to `capacity` of the strings read from any Realm as JS strings, evicting the least recently read first.
+   * Reading a string which is kept returns the same JS string again, instead of decoding and allocating a new one,
+   * which saves allocations and garbage collection when reading properties with few distinct values, such as
+   * statuses or categories. Only strings of up to 64 bytes are kept.
+   * @param capacity - The number of strings to keep. 0, the default, disables interning and releases them.
+   * @since 12.16.0
+   */
+  static setStringInternCapacity(capacity: number): void {
+    assert.integer(capacity, "capacity");
+    assert(capacity >= 0, "Expected 'capacity' to be non-negative");
+    binding.setStringInternCapacity(capacity);
+  }
+
+  /**
+   * Start recording a timeline of the activity of the SDK and every Realm, until {@link Realm.stopTracing} is called.
+   * This records spans for calls into the native binding, waiting for the write lock and committing write transactions,
+   * change listeners, scheduled callbacks, writes of the native loggers and, on Node.js, garbage collections.
+   * Events are recorded natively into a buffer per thread, and the instrumentation costs next to nothing while stopped.
+   * @param options - The size of the buffers and whether to trace calls into the binding.
+   * @throws An {@link Error} if tracing has already been started.
+   * @since 12.16.0
+   */
+  static startTracing(options: TracingOptions = {}): void {
+    startTracing(options);
+  }
+
+  /**
+   * Stop recording the timeline started by {@link Realm.startTracing}.
+   * @returns The recorded events as Chrome trace event JSON, which can be saved to a file and opened in
+   * [Perfetto](https://ui.perfetto.dev) or `chrome://tracing`.
+   * @throws An {@link Error} if tracing has not been started.
+   * @since 12.16.0
+   * @example
+   * Realm.startTracing();
+   * await doSomeWork();
+   * fs.writeFileSync("realm-trace.json", Realm.stopTracing());
+   */
+  static stopTracing(): string {
+    return stopTracing();
   }
 
   /**
@@ -171,6 +269,10 @@ export class Realm {
     ProgressRealmPromise.cancelAll();
 
     binding.Logger.setDefaultLogger(null);
+    binding.setStringInternCapacity(0);
+    if (isTracing()) {
+      stopTracing();
+    }
     garbageCollection.collect();
   }
 
@@ -187,6 +289,17 @@ export class Realm {
     fs.removeRealmFilesFromDirectory(defaultDirectoryPath);
   }
 
+  /**
+   * Like {@link Realm.clearTestState}, but deletes the files without blocking the JS thread.
+   * NOTE: Not a part of the public API and it's primarily used from the library's tests.
+   * @private
+   */
+  public static async clearTestStateAsync(): Promise<void> {
+    assert(flags.ALLOW_CLEAR_TEST_STATE, "Set the flags.ALLOW_CLEAR_TEST_STATE = true before calling this.");
+    Realm.shutdown();
+    await fs.removeRealmFilesFromDirectoryAsync(fs.getDefaultDirectoryPath());
+  }
+
   /**
    * Delete the Realm file for the given configuration.
    * @param config - The configuration for the Realm being deleted.
@@ -200,6 +313,29 @@ export class Realm {
     fs.removeFile(path + ".fresh.lock");
     fs.removeFile(path + ".note");
     fs.removeDirectory(path + ".management");
+    fs.removeFile(path + SCHEMA_FINGERPRINT_SUFFIX);
+  }
+
+  /**
+   * Delete the Realm file for the given configuration, without blocking the JS thread.
+   * The files are removed in parallel on a background thread pool.
+   * @param config - The configuration for the Realm being deleted.
+   * @throws An {@link Error} if anything in the provided {@link config} is invalid.
+   * @returns A promise which is rejected with the error code of the file system (such as `EBUSY` on Node.js),
+   * if a file couldn't be removed.
+   * @since 12.16.0
+   */
+  public static async deleteFileAsync(config: Configuration): Promise<void> {
+    validateConfiguration(config);
+    const path = Realm.determinePath(config);
+    await Promise.all([
+      fs.removeFileAsync(path),
+      fs.removeFileAsync(path + ".lock"),
+      fs.removeFileAsync(path + ".fresh.lock"),
+      fs.removeFileAsync(path + ".note"),
+      fs.removeDirectoryAsync(path + ".management"),
+      fs.removeFileAsync(path + SCHEMA_FINGERPRINT_SUFFIX),
+    ]);
   }
 
   /**
@@ -416,17 +552,27 @@ export class Realm {
   }
 
   /** @internal */
-  public static transformConfig(config: Configuration): {
+  public static transformConfig(
+    config: Configuration,
+    useSchemaFingerprint = false,
+  ): {
     schemaExtras: RealmSchemaExtra;
     bindingConfig: binding.RealmConfig_Relaxed;
+    schemaFingerprint?: SchemaFingerprint;
   } {
     const normalizedSchema = config.schema && normalizeRealmSchema(config.schema);
     const schemaExtras = Realm.extractRealmSchemaExtras(normalizedSchema || []);
     const path = Realm.determinePath(config);
     const { fifoFilesFallbackPath, shouldCompact, inMemory } = config;
-    const bindingSchema = normalizedSchema && toBindingSchema(normalizedSchema);
+    const schemaFingerprint =
+      useSchemaFingerprint && normalizedSchema && config.schemaFingerprint && !config.sync && !inMemory
+        ? new SchemaFingerprint(path, normalizedSchema, config.schemaVersion ?? 0)
+        : undefined;
+    // With a fingerprint, the schema is only converted if it turns out to be needed (see `openSharedRealm`)
+    const bindingSchema = normalizedSchema && !schemaFingerprint ? toBindingSchema(normalizedSchema) : undefined;
     return {
       schemaExtras,
+      schemaFingerprint,
       bindingConfig: {
         path,
         cache: true,
@@ -452,6 +598,35 @@ export class Realm {
     };
   }
 
+  /**
+   * Opens the Realm, reading the schema from the file instead of passing it, when it matches the fingerprint
+   * stored next to the file.
+   */
+  private static openSharedRealm(
+    bindingConfig: binding.RealmConfig_Relaxed,
+    schemaFingerprint: SchemaFingerprint | undefined,
+    realmExists: boolean,
+  ): binding.Realm {
+    if (!schemaFingerprint) {
+      return binding.Realm.getSharedRealm(bindingConfig);
+    }
+    if (realmExists && schemaFingerprint.isStored()) {
+      const internal = binding.Realm.getSharedRealm({ ...bindingConfig, schemaVersion: undefined });
+      if (schemaFingerprint.matches(internal)) {
+        debug("open with matching schema fingerprint", schemaFingerprint.value);
+        return internal;
+      }
+      internal.close();
+    }
+    const internal = binding.Realm.getSharedRealm({
+      ...bindingConfig,
+      schema: toBindingSchema(schemaFingerprint.schema),
+      schemaVersion: binding.Int64.numToInt(schemaFingerprint.schemaVersion),
+    });
+    schemaFingerprint.store(internal);
+    return internal;
+  }
+
   private static determineSchemaMode(config: Configuration): binding.SchemaMode | undefined {
     const { readOnly, deleteRealmIfMigrationNeeded, onMigration, sync } = config;
     assert(
@@ -496,6 +671,12 @@ export class Realm {
    */
   public readonly internal: binding.Realm;
 
+  /**
+   * Records the metrics returned by {@link Realm.metrics}.
+   * @internal
+   */
+  public readonly metricsRecorder = binding.RealmMetrics.make();
+
   /**
    * The sync session if this is a synced Realm
    */
@@ -506,6 +687,16 @@ export class Realm {
   private changeListeners = new RealmListeners(this, RealmEvent.Change);
   private beforeNotifyListeners = new RealmListeners(this, RealmEvent.BeforeNotify);
   private schemaListeners = new RealmListeners(this, RealmEvent.Schema);
+  private maintenance: MaintenanceScheduler | null = null;
+  private changeFeedPin: binding.Realm | null = null;
+  private compacting = false;
+  /** @internal */
+  public slowQueryLog: SlowQueryLog | null = null;
+  /**
+   * Shares the results of identical queries, if enabled by {@link Configuration.shareQueries}.
+   * @internal
+   */
+  public readonly sharedQueries: SharedQueries | null;
   /** @internal */
   public currentUpdateMode: UpdateMode | undefined;
 
@@ -547,12 +738,12 @@ export class Realm {
     if (arg !== null) {
       assert(!internalConfig.schemaExtras, "Expected either a configuration or schemaExtras");
       validateConfiguration(config);
-      const { bindingConfig, schemaExtras } = Realm.transformConfig(config);
+      const { bindingConfig, schemaExtras, schemaFingerprint } = Realm.transformConfig(config, true);
       debug("open", bindingConfig);
 
       this.schemaExtras = schemaExtras;
       fs.ensureDirectoryForFile(bindingConfig.path);
-      this.internal = internalConfig.internal ?? binding.Realm.getSharedRealm(bindingConfig);
+      this.internal = internalConfig.internal ?? Realm.openSharedRealm(bindingConfig, schemaFingerprint, realmExists);
       if (flags.ALLOW_CLEAR_TEST_STATE) {
         Realm.internals.add(new binding.WeakRef(this.internal));
       }
@@ -579,6 +770,8 @@ export class Realm {
       this.schemaExtras = schemaExtras || {};
     }
 
+    this.sharedQueries = config.shareQueries ? new SharedQueries() : null;
+
     // Optionally: Exclude or include Realm files from iCloud backup
     const { excludeFromIcloudBackup } = config;
     if (typeof excludeFromIcloudBackup === "boolean") {
@@ -745,6 +938,9 @@ export class Realm {
    * The method is idempotent.
    */
   close(): void {
+    this.stopMaintenance();
+    this.changeFeedPin?.close();
+    this.changeFeedPin = null;
     this.internal.close();
   }
 
@@ -883,6 +1079,7 @@ export class Realm {
   objectForPrimaryKey<T = DefaultObject>(type: string, primaryKey: T[keyof T]): (RealmObject<T> & T) | null;
   objectForPrimaryKey<T extends AnyRealmObject>(type: Constructor<T>, primaryKey: T[keyof T]): T | null;
   objectForPrimaryKey<T extends AnyRealmObject>(type: string | Constructor<T>, primaryKey: unknown): T | null {
+    this.assertNotCompacting();
     // Implements https://github.com/realm/realm-js/blob/v11/src/js_realm.hpp#L1240-L1258
     const { objectSchema, properties, wrapObject } = this.classes.getHelpers(type);
     if (!objectSchema.primaryKey) {
@@ -922,6 +1119,7 @@ export class Realm {
   _objectForObjectKey<T = DefaultObject>(type: string, objectKey: string): (RealmObject<T> & T) | undefined;
   _objectForObjectKey<T extends RealmObject>(type: Constructor<T>, objectKey: string): T | undefined;
   _objectForObjectKey<T extends RealmObject>(type: string | Constructor<T>, objectKey: string): T | undefined {
+    this.assertNotCompacting();
     const { objectSchema, wrapObject } = this.classes.getHelpers(type);
     if (isEmbedded(objectSchema)) {
       throw new Error("You cannot query an embedded object.");
@@ -955,6 +1153,7 @@ export class Realm {
   objects<T = DefaultObject>(type: string): Results<RealmObject<T> & T>;
   objects<T extends AnyRealmObject = RealmObject & DefaultObject>(type: Constructor<T>): Results<T>;
   objects<T extends AnyRealmObject>(type: string | Constructor<T>): Results<T> {
+    this.assertNotCompacting();
     const { internal, classes } = this;
     const { objectSchema, wrapObject } = classes.getHelpers(type);
     if (isEmbedded(objectSchema)) {
@@ -964,7 +1163,8 @@ export class Realm {
     }
 
     const table = binding.Helpers.getTable(internal, objectSchema.tableKey);
-    const results = binding.Results.fromTable(internal, table);
+    const tableResults = binding.Results.fromTable(internal, table);
+    const results = this.sharedQueries?.share(null, tableResults) ?? tableResults;
     const typeHelpers: TypeHelpers<T> = {
       fromBinding(value) {
         return wrapObject(value as binding.Obj) as T;
@@ -975,7 +1175,10 @@ export class Realm {
       },
     };
     const accessor = createResultsAccessor<T>({ realm: this, typeHelpers, itemType: binding.PropertyType.Object });
-    return new Results<T>(this, results, accessor, typeHelpers);
+    const objects = new Results<T>(this, results, accessor, typeHelpers);
+    // The objects of a table are ordered by key
+    objects.order = { descriptors: [], byKey: true };
+    return objects;
   }
 
   /**
@@ -1059,15 +1262,16 @@ export class Realm {
    * @returns Returned value from the callback.
    */
   write<T>(callback: () => T): T {
+    this.assertNotCompacting();
     let result = undefined;
-    this.internal.beginTransaction();
+    this.metricsRecorder.beginTransaction(this.internal);
     try {
       result = callback();
     } catch (err) {
       this.internal.cancelTransaction();
       throw err;
     }
-    this.internal.commitTransaction();
+    this.metricsRecorder.commitTransaction(this.internal);
     return result;
   }
 
@@ -1092,7 +1296,8 @@ export class Realm {
    * }
    */
   beginTransaction(): void {
-    this.internal.beginTransaction();
+    this.assertNotCompacting();
+    this.metricsRecorder.beginTransaction(this.internal);
   }
 
   /**
@@ -1100,7 +1305,7 @@ export class Realm {
    * @see {@link beginTransaction}
    */
   commitTransaction(): void {
-    this.internal.commitTransaction();
+    this.metricsRecorder.commitTransaction(this.internal);
   }
 
   /**
@@ -1129,6 +1334,7 @@ export class Realm {
    */
   compact(): boolean {
     assert.outTransaction(this, "Cannot compact a Realm within a transaction.");
+    this.assertNotCompacting();
     return this.internal.compact();
   }
 
@@ -1145,11 +1351,223 @@ export class Realm {
    */
   writeCopyTo(config: Configuration): void {
     assert.outTransaction(this, "Can only convert Realms outside a transaction.");
+    this.assertNotCompacting();
     validateConfiguration(config);
     const { bindingConfig } = Realm.transformConfig(config);
     this.internal.convert(bindingConfig);
   }
 
+  /**
+   * Compacts the database file like {@link compact}, but on a background thread, such that the JS thread
+   * isn't blocked while the file is rewritten.
+   *
+   * Reading from this Realm while the file is compacted would hold on to the data being rewritten, so until the
+   * promise settles, opening queries, looking up objects, writing and the other file operations of this Realm
+   * throw. Objects and collections read before the call must not be accessed either, until the promise settles.
+   * @returns A promise which resolves to `true` if compaction succeeds, `false` if not.
+   * @since 12.16.0
+   */
+  compactAsync(): Promise<boolean> {
+    assert.outTransaction(this, "Cannot compact a Realm within a transaction.");
+    this.assertNotCompacting();
+    const compacted = binding.JsFileTasks.compact(this.internal);
+    this.compacting = true;
+    return compacted.finally(() => {
+      this.compacting = false;
+    });
+  }
+
+  /**
+   * Writes a compacted copy of the Realm like {@link writeCopyTo}, but on a background thread, such
+   * that the JS thread isn't blocked while the copy is written. The copy contains the data as of the call.
+   * @param config - Realm configuration that describes the output realm.
+   * @returns A promise which resolves once the copy has been written.
+   * @since 12.16.0
+   */
+  writeCopyToAsync(config: Configuration): Promise<void> {
+    assert.outTransaction(this, "Can only convert Realms outside a transaction.");
+    this.assertNotCompacting();
+    validateConfiguration(config);
+    const { bindingConfig } = Realm.transformConfig(config);
+    return binding.JsFileTasks.writeCopy(this.internal, bindingConfig);
+  }
+
+  /**
+   * Get timing and size metrics of write transactions and change notifications, recorded since this
+   * {@link Realm} was opened or since {@link resetMetrics} was last called, along with the current
+   * file size and number of versions kept alive.
+   *
+   * Recording is cheap and always enabled.
+   * @returns A snapshot of the metrics.
+   */
+  metrics(): RealmMetrics {
+    return fromBindingMetrics(this.metricsRecorder.snapshot(this.internal));
+  }
+
+  /**
+   * Clear the metrics recorded so far.
+   * @see {@link metrics}
+   */
+  resetMetrics(): void {
+    this.metricsRecorder.reset();
+  }
+
+  /**
+   * Get how the space of the Realm file is used: its size, how much of it is free, how many versions are kept
+   * alive and which object types use the most space.
+   *
+   * This walks all the data of the current version, so avoid calling it on every change.
+   * @param options.maxTables - The number of object types to include in `largestTables`. Defaults to 10.
+   * @returns The file statistics.
+   * @since 12.16.0
+   */
+  fileStats({ maxTables = 10 }: { maxTables?: number } = {}): FileStats {
+    assert.number(maxTables, "maxTables");
+    this.assertNotCompacting();
+    return getFileStats(this.internal, maxTables);
+  }
+
+  /**
+   * Get the objects inserted, modified and deleted since the version of a token returned by a previous call,
+   * up to the version this Realm is at, such that an external copy of the data can be updated incrementally.
+   * The changes are computed natively from the transaction logs in between the versions.
+   *
+   * Only versions still held by a reader of the file can be replayed from. The version of the last token returned
+   * is held until the next call or until this Realm is closed, so a single consumer calling this repeatedly never
+   * misses changes. Local Realms don't keep the history of older versions, so tokens are only useful while this
+   * Realm stays open: a token kept across a restart of the process gets a result flagged with `reset`, like any
+   * other token of a version which is no longer available. The consumer then needs to read the Realm from scratch
+   * before continuing from the token returned.
+   *
+   * As the version held is kept in the file, the file can't shrink below it until the next call, even while the
+   * consumer is idle. Call this regularly, or close the Realm, when the file is expected to shrink.
+   * @param token - A token returned by a previous call. Omit it to get the token of the current version.
+   * @returns The changes per object type and the token to pass to the next call.
+   * @throws An {@link Error} if the token is malformed or if called within a transaction.
+   * @since 12.16.0
+   * @example
+   * let { token } = realm.changesSince();
+   * // Later, while the Realm is still open:
+   * const { changes, reset, token: next } = realm.changesSince(token);
+   */
+  changesSince(token?: string): ChangesSince {
+    assert.outTransaction(this, "Cannot get the changes of a Realm within a transaction.");
+    this.assertNotCompacting();
+    const result = getChangesSince(this.internal, token);
+    // Hold on to the version of the token returned, such that the next call can replay from it.
+    this.changeFeedPin?.close();
+    this.changeFeedPin = binding.JsChangeFeed.pin(this.internal);
+    return result;
+  }
+
+  /**
+   * Call a function and release the native state of every object, collection and query read or created while it
+   * runs, once it returns or, if it returns a promise, once the promise settles. Otherwise that state is released
+   * when the garbage collector gets to it, which can keep old versions of the Realm from being freed and grow the
+   * file in the meantime.
+   *
+   * Objects and collections from the scope can't be used after it ends, including the value returned, so return
+   * plain values from the callback. Using them throws an error saying they have been released. Scopes can be nested,
+   * in which case an inner scope releases what was created within it.
+   *
+   * On React Native, async functions can't be followed across their awaits, such that only what is created before
+   * the callback first awaits is released.
+   * @param callback - The function to call.
+   * @returns The value returned by the callback.
+   * @since 12.16.0
+   * @example
+   * const total = await realm.scope(async () => {
+   *   const orders = realm.objects(Order).filtered("shipped == false");
+   *   await notifyCustomers(orders);
+   *   return orders.sum("amount");
+   * });
+   */
+  scope<T>(callback: () => T): T {
+    assert.function(callback, "callback");
+    return runInScope(callback);
+  }
+
+  /**
+   * Start checking the file statistics periodically and compact the file while it's idle, if it crossed the
+   * thresholds of the policy. A check is idle if no changes were committed since the previous check and this
+   * instance isn't in a write transaction. Like {@link compact}, compaction is skipped while other instances of
+   * the Realm are open. The file is compacted in the background like {@link compactAsync}, so this Realm can't be
+   * used while that happens.
+   *
+   * Maintenance stops when the Realm is closed or {@link stopMaintenance} is called. Starting it again replaces the
+   * previous policy.
+   * @param policy - The thresholds, and a callback for what was done.
+   * @since 12.16.0
+   */
+  startMaintenance(policy: MaintenancePolicy = {}): void {
+    validateMaintenancePolicy(policy);
+    assert.open(this);
+    this.stopMaintenance();
+    this.maintenance = new MaintenanceScheduler(this, policy);
+    this.maintenance.start();
+  }
+
+  /**
+   * Stop the maintenance started by {@link startMaintenance}.
+   * @since 12.16.0
+   */
+  stopMaintenance(): void {
+    this.maintenance?.stop();
+    this.maintenance = null;
+  }
+
+  /**
+   * Start reporting the queries, sorts, aggregates and collection notifications which take longer than a threshold,
+   * with a description of the query, the size of the collection and the indexed properties the query refers to.
+   * Slow queries are logged as warnings, unless a callback is given.
+   *
+   * While the log is started, {@link Realm.Collection.filtered} and {@link Realm.Collection.sorted} run the query
+   * when called rather than when the collection is first read, such that they can be timed. Each call of a chain
+   * runs its query, so `a.filtered(x).filtered(y).sorted(z)` runs three queries instead of one, which makes the log
+   * meant for diagnosing rather than for leaving on. Reporting only costs reading the clock for operations faster
+   * than the threshold, on top of running them. Starting the log again replaces the previous options.
+   * @param options - The threshold, and a callback for the slow queries.
+   * @since 12.16.0
+   * @example
+   * realm.startSlowQueryLog({ thresholdMs: 50, onSlowQuery: (query) => telemetry.record(query) });
+   */
+  startSlowQueryLog(options: SlowQueryLogOptions): void {
+    validateSlowQueryLogOptions(options);
+    this.slowQueryLog = new SlowQueryLog(this, options);
+  }
+
+  /**
+   * Stop the reporting started by {@link startSlowQueryLog}.
+   * @since 12.16.0
+   */
+  stopSlowQueryLog(): void {
+    this.slowQueryLog = null;
+  }
+
+  /**
+   * Create objects from the records of an NDJSON or CSV file, in native code on background threads.
+   * Records are parsed in parallel and written by a single thread, which commits a write transaction per batch.
+   * Records which can't be parsed or written, e.g. because of a missing primary key, are counted as errors
+   * rather than failing the import.
+   *
+   * Changes are seen by this Realm once it's refreshed, like changes made by other processes.
+   * @param path - The path of the file to read.
+   * @param type - The type of objects to create. Embedded objects can't be imported.
+   * @param options - The format, the handling of existing objects and the batch size to import with.
+   * @returns A promise that resolves to the number of imported objects and errors.
+   * @throws An {@link Error} if called from within a write transaction.
+   * @since 12.16.0
+   */
+  importFrom<T extends AnyRealmObject>(
+    path: string,
+    type: string | Constructor<T>,
+    options: ImportOptions = {},
+  ): Promise<ImportResult> {
+    assert.outTransaction(this, "Cannot import within a transaction.");
+    this.assertNotCompacting();
+    return importFrom(this.internal, this.classes.getHelpers(type), path, options);
+  }
+
   /**
    * Update the schema of the Realm.
    * @param schema The schema which the Realm should be updated to use.
@@ -1183,6 +1601,18 @@ export class Realm {
     return this.classes.getHelpers<T>(arg);
   }
 
+  /**
+   * Indicates if {@link compactAsync} is compacting the file.
+   * @internal
+   */
+  get isCompacting(): boolean {
+    return this.compacting;
+  }
+
+  private assertNotCompacting(): void {
+    assert(!this.compacting, "Cannot access a Realm while it is being compacted.");
+  }
+
   /**
    * Update subscriptions with the initial subscriptions if needed.
    * @param initialSubscriptions The initial subscriptions.
@@ -1245,6 +1675,9 @@ export namespace Realm {
   export import AnyDictionary = ns.AnyDictionary;
   export import AnyList = ns.AnyList;
   export import AnyRealmObject = ns.AnyRealmObject;
+  export import AggregateOperation = ns.AggregateOperation;
+  export import AggregateSpec = ns.AggregateSpec;
+  export import Aggregation = ns.Aggregation;
   export import AnyResults = ns.AnyResults;
   export import AnySet = ns.AnySet;
   export import AnyUser = ns.AnyUser;
@@ -1256,11 +1689,13 @@ export namespace Realm {
   export import BaseConfiguration = ns.BaseConfiguration;
   export import BaseObjectSchema = ns.BaseObjectSchema;
   export import BaseSyncConfiguration = ns.BaseSyncConfiguration;
+  export import BytesChunk = ns.BytesChunk;
   export import CanonicalGeoPoint = ns.CanonicalGeoPoint;
   export import CanonicalGeoPolygon = ns.CanonicalGeoPolygon;
   export import CanonicalObjectSchema = ns.CanonicalObjectSchema;
   export import CanonicalPropertiesTypes = ns.CanonicalPropertiesTypes;
   export import CanonicalPropertySchema = ns.CanonicalPropertySchema;
+  export import ChangesSince = ns.ChangesSince;
   export import ClientResetAfterCallback = ns.ClientResetAfterCallback;
   export import ClientResetBeforeCallback = ns.ClientResetBeforeCallback;
   export import ClientResetConfig = ns.ClientResetConfig;
@@ -1273,6 +1708,7 @@ export namespace Realm {
   export import Collection = ns.Collection;
   export import CollectionChangeCallback = ns.CollectionChangeCallback;
   export import CollectionChangeSet = ns.CollectionChangeSet;
+  export import CollectionListenerOptions = ns.CollectionListenerOptions;
   export import CollectionPropertyTypeName = ns.CollectionPropertyTypeName;
   export import CompensatingWriteError = ns.CompensatingWriteError;
   export import CompensatingWriteInfo = ns.CompensatingWriteInfo;
@@ -1288,25 +1724,42 @@ export namespace Realm {
   export import Dictionary = ns.Dictionary;
   export import DictionaryChangeCallback = ns.DictionaryChangeCallback;
   export import DictionaryChangeSet = ns.DictionaryChangeSet;
+  export import DictionaryEntriesOptions = ns.DictionaryEntriesOptions;
   export import ErrorCallback = ns.ErrorCallback;
   export import EstimateProgressNotificationCallback = ns.EstimateProgressNotificationCallback;
+  export import ExportFormat = ns.ExportFormat;
+  export import ExportOptions = ns.ExportOptions;
+  export import FileLogSink = ns.FileLogSink;
+  export import FileStats = ns.FileStats;
   export import FlexibleSyncConfiguration = ns.FlexibleSyncConfiguration;
   export import GeoBox = ns.GeoBox;
   export import GeoCircle = ns.GeoCircle;
   export import GeoPoint = ns.GeoPoint;
   export import GeoPolygon = ns.GeoPolygon;
   export import GeoPosition = ns.GeoPosition;
+  export import GroupBy = ns.GroupBy;
+  export import GroupKey = ns.GroupKey;
+  export import GroupedAggregates = ns.GroupedAggregates;
+  export import ImportFormat = ns.ImportFormat;
+  export import ImportMode = ns.ImportMode;
+  export import ImportOptions = ns.ImportOptions;
+  export import ImportResult = ns.ImportResult;
   export import IndexDecorator = ns.IndexDecorator;
   export import IndexedType = ns.IndexedType;
   export import InitialSubscriptions = ns.InitialSubscriptions;
+  export import LatencyHistogram = ns.LatencyHistogram;
   export import List = ns.List;
   export import LocalAppConfiguration = ns.LocalAppConfiguration;
   export import LogCategory = ns.LogCategory;
   export import LogEntry = ns.LogEntry;
+  export import LogSink = ns.LogSink;
+  export import LogSinkFormat = ns.LogSinkFormat;
   export import Logger = ns.Logger;
   export import LoggerCallback = ns.LoggerCallback;
   export import LoggerCallback1 = ns.LoggerCallback1;
   export import LoggerCallback2 = ns.LoggerCallback2;
+  export import MaintenanceEvent = ns.MaintenanceEvent;
+  export import MaintenancePolicy = ns.MaintenancePolicy;
   export import MapToDecorator = ns.MapToDecorator;
   export import Metadata = ns.Metadata;
   export import MetadataMode = ns.MetadataMode;
@@ -1320,10 +1773,13 @@ export namespace Realm {
   export import ObjectChangeSet = ns.ObjectChangeSet;
   export import ObjectSchema = ns.ObjectSchema;
   export import ObjectType = ns.ObjectType;
+  export import ObjectTypeChanges = ns.ObjectTypeChanges;
   export import OpenRealmBehaviorConfiguration = ns.OpenRealmBehaviorConfiguration;
   export import OpenRealmBehaviorType = ns.OpenRealmBehaviorType;
   export import OpenRealmTimeOutBehavior = ns.OpenRealmTimeOutBehavior;
   export import OrderedCollection = ns.OrderedCollection;
+  export import Page = ns.Page;
+  export import PageOptions = ns.PageOptions;
   export import PartitionSyncConfiguration = ns.PartitionSyncConfiguration;
   export import PresentationPropertyTypeName = ns.PresentationPropertyTypeName;
   export import PrimaryKey = ns.PrimaryKey;
@@ -1344,6 +1800,7 @@ export namespace Realm {
   export import RealmEvent = ns.RealmEvent;
   export import RealmEventName = ns.RealmEventName;
   export import RealmListenerCallback = ns.RealmListenerCallback;
+  export import RealmMetrics = ns.RealmMetrics;
   export import RealmObjectConstructor = ns.RealmObjectConstructor;
   export import RelationshipPropertyTypeName = ns.RelationshipPropertyTypeName;
   export import Results = ns.Results;
@@ -1353,14 +1810,20 @@ export namespace Realm {
   export import SessionStopPolicy = ns.SessionStopPolicy;
   export import Set = ns.RealmSet;
   export import ShorthandPrimitivePropertyTypeName = ns.ShorthandPrimitivePropertyTypeName;
+  export import SlowQuery = ns.SlowQuery;
+  export import SlowQueryKind = ns.SlowQueryKind;
+  export import SlowQueryLogOptions = ns.SlowQueryLogOptions;
   export import SortDescriptor = ns.SortDescriptor;
   export import SSLConfiguration = ns.SSLConfiguration;
   export import SSLVerifyCallback = ns.SSLVerifyCallback;
   export import SSLVerifyObject = ns.SSLVerifyObject;
+  export import StderrLogSink = ns.StderrLogSink;
   export import SubscriptionSetState = ns.SubscriptionSetState;
   export import SyncConfiguration = ns.SyncConfiguration;
   export import SyncError = ns.SyncError;
   export import SyncProxyConfig = ns.SyncProxyConfig;
+  export import TableFileStats = ns.TableFileStats;
+  export import TracingOptions = ns.TracingOptions;
   export import TypeAssertionError = ns.TypeAssertionError;
   export import Unmanaged = ns.Unmanaged;
   export import UpdateMode = ns.UpdateMode;
@@ -18,10 +18,13 @@
 
 import { binding } from "./binding";
 import { assert } from "./assert";
+import { getPrimitiveProperties } from "./ClassHelpers";
+import { GroupBy } from "./GroupBy";
 import { IllegalConstructorError } from "./errors";
 import { injectIndirect } from "./indirect";
-import { COLLECTION_ACCESSOR as ACCESSOR } from "./Collection";
+import { COLLECTION_ACCESSOR as ACCESSOR, COLLECTION_TYPE_HELPERS as TYPE_HELPERS } from "./Collection";
 import { OrderedCollection } from "./OrderedCollection";
+import { type Page, type PageOptions, decodeCursor, encodeCursor } from "./Pagination";
 import type { Realm } from "./Realm";
 import { type SubscriptionOptions, WaitForSync } from "./app-services/MutableSubscriptionSet";
 import { TimeoutPromise } from "./TimeoutPromise";
@@ -29,6 +32,46 @@ import type { TypeHelpers } from "./TypeHelpers";
 import type { Unmanaged } from "./Unmanaged";
 import type { ResultsAccessor } from "./collection-accessors/Results";
 
+/**
+ * The file format written by {@link Results.exportTo}.
+ *
+ * `"ndjson"`
+ * : One JSON object per line, keyed by property name.
+ *
+ * `"csv"`
+ * : Comma separated values with a header row of property names. Null values are written as empty fields, and empty
+ * strings as quoted empty fields, to tell them apart.
+ *
+ * `"arrow"`
+ * : An Apache Arrow IPC stream, with a record batch per `batchSize` objects.
+ *
+ * Dates are written as ISO 8601 strings in NDJSON and CSV and as timestamps in Arrow. Data is written as Base64
+ * in NDJSON and CSV. Object IDs, UUIDs and decimals are written as strings. Values of `mixed` properties are written
+ * as Extended JSON in NDJSON and CSV, which keeps their types when imported with {@link Realm.importFrom}.
+ * @since 12.16.0
+ */
+export type ExportFormat = "ndjson" | "csv" | "arrow";
+
+/**
+ * Options for {@link Results.exportTo}.
+ * @since 12.16.0
+ */
+export type ExportOptions = {
+  /** The default is `"ndjson"`. */
+  format?: ExportFormat;
+  /**
+   * The properties to export, in order. The default is every property which isn't a link or a collection,
+   * which are the only properties that can't be exported.
+   */
+  columns?: string[];
+  /** The number of objects written at a time, which bounds the memory used while exporting. The default is 10000. */
+  batchSize?: number;
+  /** Called with the number of objects written so far, after every batch. */
+  onProgress?: (rows: number) => void;
+};
+
+const DEFAULT_EXPORT_BATCH_SIZE = 10000;
+
 /**
  * Instances of this class are typically **live** collections returned by
  * objects() that will update as new objects are either
@@ -128,6 +171,112 @@ export class Results<T = unknown> extends OrderedCollection<
     }
   }
 
+  /**
+   * Write the objects in this collection to a file, in native code on a background thread.
+   * The objects are exported as they are when this is called, even if the Realm is written to while exporting.
+   * @param path - The path of the file to write, which is replaced if it exists.
+   * @param options - The format, properties and batch size to export with.
+   * @returns A promise that resolves to the number of objects written, once the file has been written and closed.
+   * @throws An {@link Error} if this is not a collection of objects or a property can't be exported.
+   * @since 12.16.0
+   */
+  exportTo(path: string, options: ExportOptions = {}): Promise<number> {
+    const { format = "ndjson", batchSize = DEFAULT_EXPORT_BATCH_SIZE, onProgress } = options;
+    assert.string(path, "path");
+    assert(format === "ndjson" || format === "csv" || format === "arrow", `Unexpected export format: '${format}'`);
+    assert.integer(batchSize, "batchSize");
+    assert(batchSize > 0, "Expected 'batchSize' to be positive");
+    if (onProgress !== undefined) {
+      assert.function(onProgress, "onProgress");
+    }
+    const { classHelpers, type } = this;
+    assert(type === "object" && classHelpers, "Expected a result of Objects");
+    const { persistedProperties } = classHelpers.objectSchema;
+    const columns =
+      options.columns ??
+      getPrimitiveProperties(classHelpers.objectSchema).map((property) => property.publicName || property.name);
+    assert.array(columns, "columns");
+    const columnNames = columns.map((column) => {
+      assert.string(column, "column");
+      const property = persistedProperties.find((property) => (property.publicName || property.name) === column);
+      assert(property, `Property '${column}' does not exist on '${classHelpers.objectSchema.name}' objects`);
+      return property.name;
+    });
+    return binding.JsResultsExporter.exportTo(
+      this.realm.internal,
+      this.internal,
+      path,
+      format,
+      columnNames,
+      columns,
+      batchSize,
+      onProgress ?? null,
+    );
+  }
+
+  /**
+   * Group the objects in this collection by the values of one or more key paths, to compute aggregates per group
+   * natively, in a single pass over the collection.
+   * @param keyPaths - The properties to group by, which can follow links to objects, such as `"customer.name"`.
+   * @returns A {@link GroupBy} to compute the aggregates with.
+   * @throws An {@link Error} if this is not a collection of objects.
+   * @since 12.16.0
+   * @example
+   * const { length, keys, values } = orders.groupBy("customer.name").aggregate({ total: ["sum", "amount"] });
+   */
+  groupBy(keyPaths: string | string[]): GroupBy {
+    const paths = typeof keyPaths === "string" ? [keyPaths] : keyPaths;
+    assert.array(paths, "keyPaths");
+    for (const path of paths) {
+      assert.string(path, "key path");
+    }
+    assert(this.type === "object", "Expected a result of Objects");
+    return new GroupBy(this.realm, this.internal, paths);
+  }
+
+  /**
+   * Get a page of the objects in this collection, starting after the last object of the previous page.
+   * Unlike slicing by offset, a cursor refers to the values of the properties the collection is sorted by and the
+   * key of an object. The page is found natively by a binary search, in a single call, and objects inserted or
+   * deleted before the cursor don't shift the pages after it.
+   *
+   * Only the order of results of a table and of {@link sorted} is known. Other results, such as of lists or of
+   * queries with `SORT` or `DISTINCT`, are paged by scanning for the object of the cursor, which takes O(n) time.
+   * @param options - The cursor of the previous page and the size of the page.
+   * @throws An {@link Error} if this is not a collection of objects or the cursor is invalid.
+   * @returns The objects in the page and the cursor of the next page.
+   * @since 12.16.0
+   * @example
+   * const orders = realm.objects(Order).sorted("createdAt");
+   * let page = orders.page({ limit: 50 });
+   * while (page.hasMore) {
+   *   page = orders.page({ after: page.cursor, limit: 50 });
+   * }
+   */
+  page(options: PageOptions): Page<T> {
+    const { after = null, limit } = options;
+    assert.integer(limit, "limit");
+    assert(limit > 0, "Expected 'limit' to be positive");
+    const { realm, results, type } = this;
+    assert(type === "object", "Expected a result of Objects");
+    const { descriptors, byKey } = this.order;
+    const keyPaths = realm.internal.createKeyPathArray(results.objectType, descriptors.map(([keyPath]) => keyPath));
+    let page: binding.ResultsPage;
+    if (after === null) {
+      page = binding.JsResultsPager.firstPage(results, keyPaths, limit);
+    } else {
+      const { values, key } = decodeCursor(after);
+      const ascending = descriptors.map(([, isAscending]) => isAscending);
+      page = binding.JsResultsPager.pageAfter(results, keyPaths, ascending, byKey, values, key, limit);
+    }
+    const { fromBinding } = this[TYPE_HELPERS];
+    return {
+      items: page.objects.map((obj) => fromBinding(obj)),
+      cursor: page.objects.length > 0 ? encodeCursor({ values: page.cursorValues, key: page.cursorKey }) : after,
+      hasMore: page.hasMore,
+    };
+  }
+
   /**
    * Add this query result to the set of active subscriptions. The query will be joined
    * via an `OR` operator with any existing queries for the same type.
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { asyncContext } from "./platform";
+
+type Releasable = { $release(): void };
+
+class WrapperScope {
+  private wrappers: Releasable[] = [];
+  private released = false;
+
+  track(wrapper: Releasable) {
+    // Wrappers created by async continuations which outlive the scope aren't released.
+    if (!this.released) {
+      this.wrappers.push(wrapper);
+    }
+  }
+
+  release() {
+    this.released = true;
+    for (const wrapper of this.wrappers) {
+      wrapper.$release();
+    }
+    this.wrappers = [];
+  }
+}
+
+/** The number of scopes which haven't ended, such that wrappers are only tracked while there are any. */
+let activeScopes = 0;
+
+function trackWrapper(wrapper: object) {
+  const scope = asyncContext.getStore();
+  if (scope instanceof WrapperScope && typeof (wrapper as Partial<Releasable>).$release === "function") {
+    scope.track(wrapper as Releasable);
+  }
+}
+
+function isPromiseLike(value: unknown): value is PromiseLike<unknown> {
+  return typeof value === "object" && value !== null && typeof (value as PromiseLike<unknown>).then === "function";
+}
+
+/**
+ * Whether wrappers created now would be released by a scope.
+ * @internal
+ */
+export function isInScope(): boolean {
+  // Checking the count first keeps this cheap for the callers on hot paths, while no scope is active.
+  return activeScopes > 0 && asyncContext.getStore() instanceof WrapperScope;
+}
+
+/** @internal */
+export function runInScope<T>(callback: () => T): T {
+  const scope = new WrapperScope();
+  if (activeScopes++ === 0) {
+    binding.setWrapperTracker(trackWrapper);
+  }
+  const end = () => {
+    scope.release();
+    if (--activeScopes === 0) {
+      binding.setWrapperTracker(null);
+    }
+  };
+  let result: T;
+  try {
+    result = asyncContext.run(scope, callback);
+  } catch (err) {
+    end();
+    throw err;
+  }
+  if (isPromiseLike(result)) {
+    return Promise.resolve(result).finally(end) as T;
+  }
+  end();
+  return result;
+}
@@ -26,6 +26,9 @@ import type { Realm } from "./Realm";
 import type { TypeHelpers } from "./TypeHelpers";
 import type { SetAccessor } from "./collection-accessors/Set";
 
+type SetRelation = "subset" | "superset" | "intersects";
+type SetOperation = "union" | "intersection" | "difference" | "symmetricDifference";
+
 /**
  * Instances of this class will be returned when accessing object properties whose type is `"Set"`
  *
@@ -135,6 +138,117 @@ export class RealmSet<T = unknown> extends OrderedCollection<
     return this.includes(value);
   }
 
+  /**
+   * Check if every value of this Set is in `other`.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns `true` if this Set is a subset of `other`, `false` if not.
+   * @since 12.16.0
+   */
+  isSubsetOf(other: RealmSet<T> | T[]): boolean {
+    return this.test(other, "subset");
+  }
+
+  /**
+   * Check if every value of `other` is in this Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns `true` if this Set is a superset of `other`, `false` if not.
+   * @since 12.16.0
+   */
+  isSupersetOf(other: RealmSet<T> | T[]): boolean {
+    return this.test(other, "superset");
+  }
+
+  /**
+   * Check if any value of `other` is in this Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns `true` if this Set and `other` have a value in common, `false` if not.
+   * @since 12.16.0
+   */
+  intersects(other: RealmSet<T> | T[]): boolean {
+    return this.test(other, "intersects");
+  }
+
+  /**
+   * Compute the union of this Set and `other`, without modifying the Set.
+   * Like the other set operations, this is evaluated natively in a single call.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns The values which are in this Set, `other` or both.
+   * @since 12.16.0
+   */
+  union(other: RealmSet<T> | T[]): T[] {
+    return this.combine(other, "union");
+  }
+
+  /**
+   * Compute the intersection of this Set and `other`, without modifying the Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns The values which are both in this Set and `other`.
+   * @since 12.16.0
+   */
+  intersection(other: RealmSet<T> | T[]): T[] {
+    return this.combine(other, "intersection");
+  }
+
+  /**
+   * Compute the difference of this Set and `other`, without modifying the Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns The values which are in this Set but not in `other`.
+   * @since 12.16.0
+   */
+  difference(other: RealmSet<T> | T[]): T[] {
+    return this.combine(other, "difference");
+  }
+
+  /**
+   * Compute the symmetric difference of this Set and `other`, without modifying the Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @returns The values which are in either this Set or `other`, but not in both.
+   * @since 12.16.0
+   */
+  symmetricDifference(other: RealmSet<T> | T[]): T[] {
+    return this.combine(other, "symmetricDifference");
+  }
+
+  /**
+   * Add the values of `other` which are not already in this Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @throws An {@link Error} if not inside a write transaction.
+   * @since 12.16.0
+   */
+  formUnion(other: RealmSet<T> | T[]): void {
+    this.assign(other, "union");
+  }
+
+  /**
+   * Remove the values which are not in `other` from this Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @throws An {@link Error} if not inside a write transaction.
+   * @since 12.16.0
+   */
+  formIntersection(other: RealmSet<T> | T[]): void {
+    this.assign(other, "intersection");
+  }
+
+  /**
+   * Remove the values which are in `other` from this Set.
+   * @param other - A Set of the same Realm or an array of values.
+   * @throws An {@link Error} if not inside a write transaction.
+   * @since 12.16.0
+   */
+  subtract(other: RealmSet<T> | T[]): void {
+    this.assign(other, "difference");
+  }
+
+  /**
+   * Remove the values which are in `other` from this Set, and add those of `other` which were not in it.
+   * @param other - A Set of the same Realm or an array of values.
+   * @throws An {@link Error} if not inside a write transaction.
+   * @since 12.16.0
+   */
+  formSymmetricDifference(other: RealmSet<T> | T[]): void {
+    this.assign(other, "symmetricDifference");
+  }
+
   /**
    * @see {@link https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Set/entries | Set.prototype.entries()}
    * @returns An iterator over the entries of the Set. Each entry is a two-element array
@@ -145,6 +259,46 @@ export class RealmSet<T = unknown> extends OrderedCollection<
       yield [value, value] as [T, T];
     }
   }
+
+  /** @internal */
+  private test(other: RealmSet<T> | T[], relation: SetRelation): boolean {
+    const operand = this.operand(other);
+    return Array.isArray(operand)
+      ? binding.JsSetAlgebra.testValues(this.internal, operand, relation)
+      : binding.JsSetAlgebra.test(this.internal, operand, relation);
+  }
+
+  /** @internal */
+  private combine(other: RealmSet<T> | T[], operation: SetOperation): T[] {
+    const operand = this.operand(other);
+    const values = Array.isArray(operand)
+      ? binding.JsSetAlgebra.combineValues(this.internal, operand, operation)
+      : binding.JsSetAlgebra.combine(this.internal, operand, operation);
+    const { fromBinding } = this[TYPE_HELPERS];
+    return values.map((value) => fromBinding(value));
+  }
+
+  /** @internal */
+  private assign(other: RealmSet<T> | T[], operation: SetOperation): void {
+    assert.inTransaction(this.realm);
+    const operand = this.operand(other);
+    if (Array.isArray(operand)) {
+      binding.JsSetAlgebra.assignValues(this.internal, operand, operation);
+    } else {
+      binding.JsSetAlgebra.assign(this.internal, operand, operation);
+    }
+  }
+
+  /** @internal */
+  private operand(other: RealmSet<T> | T[]): binding.Set | binding.MixedArg[] {
+    if (Array.isArray(other)) {
+      const { toBinding } = this[TYPE_HELPERS];
+      return other.map((value) => toBinding(value));
+    }
+    assert.instanceOf(other, RealmSet, "other");
+    assert.isSameRealm(other.realm.internal, this.realm.internal, "Expected a Set of the same Realm");
+    return other.internal;
+  }
 }
 
 /* eslint-disable-next-line @typescript-eslint/no-explicit-any -- We define these once to avoid using "any" through the code */
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import type { CollectionChangeSet } from "./OrderedCollection";
+import { unwind } from "./ranges";
+import { isInScope } from "./Scope";
+
+type ChangeHandler = (changes: CollectionChangeSet) => void;
+
+type Subscription = {
+  token: binding.NotificationToken;
+  handlers: Set<ChangeHandler>;
+  /** Whether the notification sent when the callback was added has been delivered. */
+  delivered: boolean;
+};
+
+/** The number of queries at which the registry is first swept for queries which have been garbage collected. */
+const INITIAL_SWEEP_SIZE = 64;
+
+/**
+ * Shares the native results of identical queries on a Realm, such that listeners on them share a single notifier
+ * which computes the changes once per commit. Results are shared when they are of a whole table, or derived from
+ * shared results by a query or a sort, as their description then identifies them: it includes the object type, the
+ * query with its arguments and the sorting. Listeners added without key paths or options are subscribed to a single
+ * native callback per results, which fans the changes out to them and is removed along with the last listener.
+ * @internal
+ */
+export class SharedQueries {
+  /** Results which are shared, or derived from shared results by a query or a sort. */
+  private readonly shareable = new WeakSet<binding.Results>();
+  private readonly queries = new Map<string, binding.WeakRef<binding.Results>>();
+  private readonly subscriptions = new Map<binding.Results, Subscription>();
+  private nextSweepSize = INITIAL_SWEEP_SIZE;
+
+  /**
+   * Get the results to use in place of results created by a query or a sort of `parent`, or of a whole table if
+   * `parent` is `null`. These are the results of an identical query which are still in use, if there are any.
+   */
+  share(parent: binding.Results | null, results: binding.Results): binding.Results {
+    if (parent && !this.shareable.has(parent)) {
+      return results;
+    }
+    const key = `${results.objectType}\n${binding.Helpers.getResultsDescription(results)}`;
+    const existing = this.queries.get(key)?.deref();
+    if (existing) {
+      return existing;
+    }
+    // Results created within a scope are released when it ends, so they can't be shared.
+    if (!isInScope()) {
+      this.shareable.add(results);
+      this.queries.set(key, new binding.WeakRef(results));
+      if (this.queries.size >= this.nextSweepSize) {
+        this.sweep();
+      }
+    }
+    return results;
+  }
+
+  /**
+   * Call `handler` with the changes of shared results, from a native callback shared with the other handlers.
+   * @returns A token to remove the handler with.
+   */
+  subscribe(results: binding.Results, handler: ChangeHandler): Pick<binding.NotificationToken, "unregister"> {
+    let subscription = this.subscriptions.get(results);
+    if (!subscription) {
+      const subscribers = new Set<ChangeHandler>();
+      const token = results.addNotificationCallback((changes) => {
+        const changeSet: CollectionChangeSet = {
+          deletions: unwind(changes.deletions),
+          insertions: unwind(changes.insertions),
+          oldModifications: unwind(changes.modifications),
+          newModifications: unwind(changes.modificationsNew),
+        };
+        if (subscription) {
+          subscription.delivered = true;
+        }
+        // Copied, such that handlers added or removed by the handlers don't affect this delivery.
+        for (const deliver of [...subscribers]) {
+          deliver(changeSet);
+        }
+      }, undefined);
+      subscription = { token, handlers: subscribers, delivered: false };
+      this.subscriptions.set(results, subscription);
+    }
+    const { handlers, token, delivered } = subscription;
+    handlers.add(handler);
+    if (delivered) {
+      // Like a callback of its own, the handler is notified once it has been added.
+      setImmediate(() => {
+        if (handlers.has(handler)) {
+          handler({ deletions: [], insertions: [], oldModifications: [], newModifications: [] });
+        }
+      });
+    }
+    return {
+      unregister: () => {
+        if (handlers.delete(handler) && handlers.size === 0) {
+          token.unregister();
+          this.subscriptions.delete(results);
+        }
+      },
+    };
+  }
+
+  private sweep() {
+    for (const [key, ref] of this.queries) {
+      if (!ref.deref()) {
+        this.queries.delete(key);
+      }
+    }
+    this.nextSweepSize = Math.max(INITIAL_SWEEP_SIZE, this.queries.size * 2);
+  }
+}
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "./binding";
+import { assert } from "./assert";
+import type { Realm } from "./Realm";
+
+/**
+ * What took longer than the threshold of the slow query log:
+ *
+ * `"filter"`
+ * : Evaluating the query of {@link Realm.Collection.filtered}.
+ *
+ * `"sort"`
+ * : Evaluating the query and sorting the objects of {@link Realm.Collection.sorted}.
+ *
+ * `"aggregate"`
+ * : Computing a minimum, maximum, sum or average of a collection.
+ *
+ * `"listener"`
+ * : Calling a listener of a collection with its changes. This times the listener itself, on the JS thread, and not
+ * running the query again, which happens on a background thread.
+ * @since 12.16.0
+ */
+export type SlowQueryKind = "filter" | "sort" | "aggregate" | "listener";
+
+/**
+ * A query which took longer than the threshold of the slow query log.
+ * @since 12.16.0
+ */
+export type SlowQuery = {
+  kind: SlowQueryKind;
+  /** The query and sorting of the collection, as described by Realm. */
+  description: string;
+  /** The object type of the collection, or `"(values)"` for collections of primitive values. */
+  objectType: string;
+  /** The number of values in the collection. */
+  size: number;
+  elapsedMs: number;
+  /** The aggregate computed, such as `"sum(amount)"`, for the `"aggregate"` kind. */
+  aggregate?: string;
+  /**
+   * The properties with an index which the query refers to. When this is empty, the query couldn't have used
+   * an index and had to check every object.
+   */
+  indexedProperties: string[];
+};
+
+/**
+ * Options for {@link Realm.startSlowQueryLog}.
+ * @since 12.16.0
+ */
+export type SlowQueryLogOptions = {
+  /**
+   * Queries taking at least this many milliseconds are reported. Every `filtered()` and `sorted()` runs its query
+   * when called while the log is started, to time it, including the intermediate calls of a chain.
+   */
+  thresholdMs: number;
+  /**
+   * Called with every slow query. The default is to log a warning in the `"Realm.Storage.Query"` category,
+   * through the logger set with {@link Realm.setLogger}.
+   */
+  onSlowQuery?: (query: SlowQuery) => void;
+};
+
+/** @internal */
+export function validateSlowQueryLogOptions(options: unknown): asserts options is SlowQueryLogOptions {
+  assert.object(options, "options");
+  const { thresholdMs, onSlowQuery } = options;
+  assert.number(thresholdMs, "thresholdMs");
+  assert(thresholdMs >= 0, "Expected 'thresholdMs' to be zero or positive");
+  if (onSlowQuery !== undefined) {
+    assert.function(onSlowQuery, "onSlowQuery");
+  }
+}
+
+const STRING_LITERAL = /"(?:[^"\\]|\\.)*"|'(?:[^'\\]|\\.)*'/g;
+const IDENTIFIER = /[A-Za-z_$][\w$]*/g;
+
+function formatSlowQuery({ kind, description, objectType, size, elapsedMs, aggregate, indexedProperties }: SlowQuery) {
+  const what = aggregate ? `${kind} ${aggregate}` : kind;
+  const indexes = indexedProperties.length > 0 ? indexedProperties.join(", ") : "none";
+  const details = `${size} results, indexed properties: ${indexes}`;
+  return `Slow ${what} on '${objectType}' took ${elapsedMs.toFixed(1)} ms (${details}): ${description}`;
+}
+
+function logSlowQuery(query: SlowQuery) {
+  binding.JsLogSinks.log("Realm.Storage.Query", binding.LoggerLevel.Warn, formatSlowQuery(query));
+}
+
+/**
+ * Reports collection operations taking longer than a threshold. Operations are timed by the collections,
+ * while the Realm has a log, and only those above the threshold are described, which is the expensive part.
+ * @internal
+ */
+export class SlowQueryLog {
+  private readonly thresholdMs: number;
+  private readonly onSlowQuery: (query: SlowQuery) => void;
+
+  constructor(
+    private readonly realm: Realm,
+    { thresholdMs, onSlowQuery }: SlowQueryLogOptions,
+  ) {
+    this.thresholdMs = thresholdMs;
+    this.onSlowQuery = onSlowQuery ?? logSlowQuery;
+  }
+
+  /** Call a function operating on a collection, reporting it if it takes longer than the threshold. */
+  measure<T>(kind: SlowQueryKind, results: binding.Results, operation: () => T, aggregate?: string): T {
+    const start = performance.now();
+    const result = operation();
+    this.record(kind, results, performance.now() - start, aggregate);
+    return result;
+  }
+
+  record(kind: SlowQueryKind, results: binding.Results, elapsedMs: number, aggregate?: string): void {
+    if (elapsedMs < this.thresholdMs || !results.isValid) {
+      return;
+    }
+    const description = binding.Helpers.getResultsDescription(results);
+    const objectType = results.objectType;
+    this.onSlowQuery({
+      kind,
+      description,
+      objectType: objectType || "(values)",
+      size: results.size(),
+      elapsedMs,
+      aggregate,
+      indexedProperties: objectType ? this.getIndexedProperties(objectType, description) : [],
+    });
+  }
+
+  private getIndexedProperties(objectType: string, description: string): string[] {
+    const identifiers = new Set(description.replace(STRING_LITERAL, "").match(IDENTIFIER));
+    const { persistedProperties } = this.realm.getClassHelpers(objectType).objectSchema;
+    return persistedProperties
+      .filter(({ name, isIndexed, isPrimary, isFulltextIndexed }) => {
+        return (isIndexed || isPrimary || isFulltextIndexed) && identifiers.has(name);
+      })
+      .map(({ name, publicName }) => publicName || name);
+  }
+}
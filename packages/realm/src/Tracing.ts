@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { assert } from "./assert";
+import { binding } from "./binding";
+import { definedClasses } from "./binding/patch";
+import { garbageCollection } from "./platform";
+
+/**
+ * Options for {@link Realm.startTracing}.
+ * @since 12.16.0
+ */
+export type TracingOptions = {
+  /**
+   * The number of events kept per thread, beyond which events are dropped and counted. The default is 100000.
+   * The memory for the events of a thread is reserved when it records its first event.
+   */
+  eventsPerThread?: number;
+  /** Record a span for every call from the SDK into the binding. The default is `true`. */
+  bindingCalls?: boolean;
+};
+
+const DEFAULT_EVENTS_PER_THREAD = 100000;
+
+/** Classes of the binding which are never traced, as the tracing itself calls them. */
+const UNTRACED_CLASSES = new Set(["JsTraceRecorder"]);
+
+type Session = {
+  /** The offset from `performance.now()` in microseconds to the timestamps of the trace. */
+  offsetUs: number;
+  /** Restores the methods of the binding replaced to trace calls. */
+  restores: (() => void)[];
+  stopObservingGarbageCollection: () => void;
+};
+
+let session: Session | null = null;
+
+function record(category: string, name: string, startMs: number, durationMs: number, detail = "") {
+  assert(session);
+  binding.JsTraceRecorder.record(category, name, startMs * 1000 + session.offsetUs, durationMs * 1000, detail);
+}
+
+function traceMethods(target: Record<string, unknown>, label: string, restores: (() => void)[]) {
+  for (const key of Object.getOwnPropertyNames(target)) {
+    const descriptor = Object.getOwnPropertyDescriptor(target, key);
+    // Skips getters, the constructor and methods which are internal to the binding, such as `_extract` and `$release`
+    if (!descriptor || typeof descriptor.value !== "function" || key === "constructor" || /^[_$]/.test(key)) {
+      continue;
+    }
+    const method = descriptor.value as (...args: unknown[]) => unknown;
+    const name = `${label}.${key}`;
+    Object.defineProperty(target, key, {
+      ...descriptor,
+      value: function (this: unknown, ...args: unknown[]) {
+        const start = performance.now();
+        try {
+          return method.apply(this, args);
+        } finally {
+          record("binding", name, start, performance.now() - start);
+        }
+      },
+    });
+    restores.push(() => Object.defineProperty(target, key, descriptor));
+  }
+}
+
+function traceClass(name: string, cls: unknown, restores: (() => void)[]) {
+  if (UNTRACED_CLASSES.has(name) || typeof cls !== "function") {
+    return;
+  }
+  traceMethods(cls as unknown as Record<string, unknown>, name, restores);
+  traceMethods(cls.prototype, name, restores);
+}
+
+/** @internal */
+export function isTracing(): boolean {
+  return session !== null;
+}
+
+/** @internal */
+export function startTracing({ eventsPerThread = DEFAULT_EVENTS_PER_THREAD, bindingCalls = true }: TracingOptions) {
+  assert(session === null, "Tracing has already been started");
+  assert.integer(eventsPerThread, "eventsPerThread");
+  assert(eventsPerThread > 0, "Expected 'eventsPerThread' to be positive");
+  assert.boolean(bindingCalls, "bindingCalls");
+
+  binding.JsTraceRecorder.nameThread("JavaScript");
+  binding.JsTraceRecorder.start(eventsPerThread);
+  const restores: (() => void)[] = [];
+  session = {
+    offsetUs: binding.JsTraceRecorder.nowUs() - performance.now() * 1000,
+    restores,
+    stopObservingGarbageCollection: garbageCollection.observe(({ startTime, duration, kind }) => {
+      // Collections reported after tracing stopped are dropped natively.
+      if (session) {
+        record("gc", "garbage collection", startTime, duration, kind);
+      }
+    }),
+  };
+  if (bindingCalls) {
+    for (const [name, cls] of definedClasses.classes) {
+      traceClass(name, cls, restores);
+    }
+    definedClasses.onDefine = (name, cls) => traceClass(name, cls, restores);
+  }
+}
+
+/** @internal */
+export function stopTracing(): string {
+  assert(session, "Tracing has not been started");
+  const { restores, stopObservingGarbageCollection } = session;
+  definedClasses.onDefine = null;
+  for (const restore of restores.reverse()) {
+    restore();
+  }
+  stopObservingGarbageCollection();
+  session = null;
+  return binding.JsTraceRecorder.stop();
+}
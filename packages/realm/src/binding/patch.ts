@@ -63,47 +63,84 @@ declare module "./wrapper.generated" {
 }
 
 /**
- * Applies SDK level patches to the binding.
- * This should only be called after the binding has been injected.
+ * The classes of the binding defined so far, by name, and a callback for the classes defined from now on.
+ * Used to trace calls into the binding, which needs to patch the classes when tracing starts.
  * @internal
  */
-export function applyPatch(binding: Binding) {
-  binding.IndexSet.prototype.asIndexes = function* (this: binding.IndexSet) {
-    for (const [from, to] of this) {
-      let i = from;
-      while (i < to) {
-        yield i;
-        i++;
-      }
+export const definedClasses = {
+  classes: new Map<string, unknown>(),
+  onDefine: null as ((name: string, cls: unknown) => void) | null,
+};
+
+/**
+ * Applies SDK level patches to a class of the binding.
+ * This is called by the binding when the class is defined, which happens when it's first used.
+ * @internal
+ */
+export function applyClassPatch(binding: Binding, name: string, cls: unknown) {
+  definedClasses.classes.set(name, cls);
+  definedClasses.onDefine?.(name, cls);
+  switch (name) {
+    case "IndexSet": {
+      const IndexSet = cls as Binding["IndexSet"];
+      IndexSet.prototype.asIndexes = function* (this: binding.IndexSet) {
+        for (const [from, to] of this) {
+          let i = from;
+          while (i < to) {
+            yield i;
+            i++;
+          }
+        }
+      };
+      break;
     }
-  };
 
-  binding.Timestamp.fromDate = (d: Date) =>
-    binding.Timestamp.make(binding.Int64.numToInt(Math.floor(d.valueOf() / 1000)), (d.valueOf() % 1000) * 1000_000);
+    case "Timestamp": {
+      const Timestamp = cls as Binding["Timestamp"];
+      Timestamp.fromDate = (d: Date) =>
+        Timestamp.make(binding.Int64.numToInt(Math.floor(d.valueOf() / 1000)), (d.valueOf() % 1000) * 1000_000);
 
-  binding.Timestamp.prototype.toDate = function () {
-    return new Date(Number(this.seconds) * 1000 + this.nanoseconds / 1000_000);
-  };
+      Timestamp.prototype.toDate = function () {
+        return new Date(Number(this.seconds) * 1000 + this.nanoseconds / 1000_000);
+      };
+      break;
+    }
 
-  binding.SyncSession.prototype.weaken = function () {
-    try {
-      return binding.WeakSyncSession.weakCopyOf(this);
-    } finally {
-      this.$resetSharedPtr();
+    case "SyncSession": {
+      const SyncSession = cls as Binding["SyncSession"];
+      SyncSession.prototype.weaken = function () {
+        try {
+          return binding.WeakSyncSession.weakCopyOf(this);
+        } finally {
+          this.$resetSharedPtr();
+        }
+      };
+      break;
     }
-  };
 
-  binding.WeakSyncSession.prototype.withDeref = function <Ret = void>(
-    callback: (shared: binding.SyncSession | null) => Ret,
-  ) {
-    const shared = this.rawDereference();
-    try {
-      return callback(shared);
-    } finally {
-      shared?.$resetSharedPtr();
+    case "WeakSyncSession": {
+      const WeakSyncSession = cls as Binding["WeakSyncSession"];
+      WeakSyncSession.prototype.withDeref = function <Ret = void>(
+        callback: (shared: binding.SyncSession | null) => Ret,
+      ) {
+        const shared = this.rawDereference();
+        try {
+          return callback(shared);
+        } finally {
+          shared?.$resetSharedPtr();
+        }
+      };
+      break;
     }
-  };
+  }
+}
 
+/**
+ * Applies SDK level patches to the binding.
+ * This should only be called after the binding has been injected.
+ * @internal
+ */
+export function applyPatch(binding: Binding) {
   binding.InvalidObjKey = class InvalidObjKey extends TypeError {
     constructor(input: string) {
       super(`Cannot convert '${input}' to an ObjKey`);
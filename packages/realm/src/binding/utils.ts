@@ -55,6 +55,36 @@ export function _throwOnAccess(propertyName: string) {
   throw new Error(`Accessed property '${propertyName} before the native module was injected into the Realm binding'`);
 }
 
+/**
+ * Creates a property descriptor which gets the value of the property on first access,
+ * and replaces itself with the value, such that later accesses are plain property reads.
+ * @internal
+ */
+export function _lazyProperty(target: object, propertyName: string, get: () => unknown): PropertyDescriptor {
+  return {
+    get() {
+      const value = get();
+      Object.defineProperty(target, propertyName, { value, writable: false, configurable: false });
+      return value;
+    },
+    configurable: true,
+  };
+}
+
+/**
+ * The function called with every wrapper constructed while it is set.
+ * @internal
+ */
+export const _wrapperTracker: { track: ((wrapper: object) => void) | null } = { track: null };
+
+/**
+ * Set a function to call with every wrapper constructed from here on, or `null` to stop tracking wrappers.
+ * Wrappers of classes which can be released early have a `$release` method.
+ */
+export function setWrapperTracker(track: ((wrapper: object) => void) | null) {
+  _wrapperTracker.track = track;
+}
+
 // Wrapped types
 
 export class Float {
@@ -31,4 +31,11 @@ export const flags = {
    * This is disabled by default, mainly because the data-structures needed to support this, introduce minor memory leaks if clearTestState() is not called regularly and are not intended for production use.
    */
   ALLOW_CLEAR_TEST_STATE: false,
+  /**
+   * When enabled on React Native, Realm objects are exposed as JSI host objects which read and write properties of
+   * type `int`, `bool`, `float`, `double` and `string` directly in C++, bypassing the JS property accessors.
+   * Everything else is forwarded to a regular Realm object. Has no effect on Node.js.
+   * Only applies to Realms opened after it is enabled.
+   */
+  OBJECT_HOST_FAST_PATH: false,
 };
@@ -29,6 +29,7 @@ export * from "./ObjectListeners";
 export * from "./Collection";
 export * from "./OrderedCollection";
 export * from "./Results";
+export * from "./Pagination";
 export * from "./List";
 export * from "./Set";
 export * from "./Dictionary";
@@ -37,6 +38,13 @@ export * from "./Counter";
 export * from "./Types";
 export * from "./GeoSpatial";
 export * from "./Logger";
+export * from "./Metrics";
+export * from "./Maintenance";
+export * from "./Import";
+export * from "./GroupBy";
+export * from "./ChangeFeed";
+export * from "./SlowQueryLog";
+export * from "./Tracing";
 
 export * from "./app-services/utils";
 export * from "./app-services/SyncConfiguration";
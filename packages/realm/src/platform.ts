@@ -28,3 +28,5 @@ export { network } from "./platform/network";
 export { syncProxyConfig } from "./platform/sync-proxy-config";
 /** @internal */
 export { garbageCollection } from "./platform/garbage-collection";
+/** @internal */
+export { asyncContext } from "./platform/async-context";
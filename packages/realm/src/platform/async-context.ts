@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+type AsyncContextType = {
+  /** True if the store follows async functions across their awaits, false if it's only set while `run` runs. */
+  followsAwaits: boolean;
+  /** Call a function with a store, returned by `getStore` until the function returns. */
+  run<T>(store: unknown, callback: () => T): T;
+  getStore(): unknown;
+};
+
+let currentStore: unknown = undefined;
+
+export const asyncContext: AsyncContextType = {
+  followsAwaits: false,
+  run(store, callback) {
+    const previous = currentStore;
+    currentStore = store;
+    try {
+      return callback();
+    } finally {
+      currentStore = previous;
+    }
+  },
+  getStore() {
+    return currentStore;
+  },
+};
+
+export function inject(value: AsyncContextType) {
+  Object.freeze(Object.assign(asyncContext, value));
+}
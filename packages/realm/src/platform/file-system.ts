@@ -28,6 +28,9 @@ type FileSystemType = {
   copyBundledRealmFiles(): void;
   // readDirectory(path: string): Dirent[];
   removeRealmFilesFromDirectory(path: string): void;
+  removeFileAsync(path: string): Promise<void>;
+  removeDirectoryAsync(path: string): Promise<void>;
+  removeRealmFilesFromDirectoryAsync(path: string): Promise<void>;
 };
 
 export type Dirent = {
@@ -72,6 +75,15 @@ export const fs: FileSystemType = {
   removeRealmFilesFromDirectory() {
     throw new Error("Not supported on this platform");
   },
+  removeFileAsync() {
+    throw new Error("Not supported on this platform");
+  },
+  removeDirectoryAsync() {
+    throw new Error("Not supported on this platform");
+  },
+  removeRealmFilesFromDirectoryAsync() {
+    throw new Error("Not supported on this platform");
+  },
 };
 
 export function inject(value: FileSystemType) {
@@ -16,10 +16,20 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-type ShutdownType = { collect: () => void };
+/** A garbage collection, timed in milliseconds like `performance.now()`. */
+export type GarbageCollectionEntry = { startTime: number; duration: number; kind: string };
+
+type ShutdownType = {
+  collect: () => void;
+  /** Call back with every garbage collection until the returned function is called, if the platform reports them. */
+  observe: (callback: (entry: GarbageCollectionEntry) => void) => () => void;
+};
 
 export const garbageCollection: ShutdownType = {
   collect() {},
+  observe() {
+    return () => {};
+  },
 };
 
 export function inject(value: ShutdownType) {
@@ -20,4 +20,12 @@ import { NativeBigInt, type binding, injectNativeModule } from "../binding";
 
 // eslint-disable-next-line @typescript-eslint/no-var-requires
 const nativeModule = require("#realm.node");
-injectNativeModule(nativeModule, { Int64: NativeBigInt as typeof binding.Int64, WeakRef });
+
+// The addon creates the JS functions of its exports when they are first looked up, to load faster.
+const lazyNativeModule = new Proxy(nativeModule, {
+  get(target, name) {
+    return typeof name === "string" && !(name in target) ? target.getFunction(name) : target[name];
+  },
+});
+
+injectNativeModule(lazyNativeModule, { Int64: NativeBigInt as typeof binding.Int64, WeakRef });
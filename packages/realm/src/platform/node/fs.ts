@@ -18,6 +18,7 @@
 
 import { existsSync, mkdirSync, readdirSync, rmSync, unlinkSync } from "node:fs";
 import { dirname, isAbsolute, join } from "node:path";
+import { getSystemErrorName } from "node:util";
 
 import { inject } from "../file-system";
 import { extendDebug } from "../../debug";
@@ -25,6 +26,19 @@ import { binding } from "../binding";
 
 const debug = extendDebug("fs");
 
+/**
+ * The native file tasks report libuv error codes, which are exposed the same way as `node:fs` does.
+ */
+function toSystemError(err: unknown): never {
+  if (err instanceof Error) {
+    const { category, code } = err as Error & { category?: unknown; code?: unknown };
+    if (category === "uv" && typeof code === "number") {
+      Object.assign(err, { errno: code, code: getSystemErrorName(code) });
+    }
+  }
+  throw err;
+}
+
 inject({
   isAbsolutePath(path) {
     return isAbsolute(path);
@@ -82,4 +96,16 @@ inject({
       }
     }
   },
+  removeFileAsync(path) {
+    debug("removeFileAsync", path);
+    return binding.JsPlatformHelpers.removeFileAsync(path).catch(toSystemError);
+  },
+  removeDirectoryAsync(path) {
+    debug("removeDirectoryAsync", path);
+    return binding.JsPlatformHelpers.removeDirectoryAsync(path).catch(toSystemError);
+  },
+  removeRealmFilesFromDirectoryAsync(path) {
+    debug("removeRealmFilesFromDirectoryAsync", path);
+    return binding.JsPlatformHelpers.removeRealmFilesFromDirectoryAsync(path).catch(toSystemError);
+  },
 });
@@ -18,9 +18,17 @@
 
 import v8 from "node:v8";
 import vm from "node:vm";
+import { PerformanceObserver, constants } from "node:perf_hooks";
 
 import { inject } from "../garbage-collection";
 
+const GC_KINDS: Record<number, string> = {
+  [constants.NODE_PERFORMANCE_GC_MAJOR]: "major",
+  [constants.NODE_PERFORMANCE_GC_MINOR]: "minor",
+  [constants.NODE_PERFORMANCE_GC_INCREMENTAL]: "incremental",
+  [constants.NODE_PERFORMANCE_GC_WEAKCB]: "weak callbacks",
+};
+
 inject({
   collect() {
     // Ensure we have the gc function available
@@ -29,4 +37,14 @@ inject({
     // Garbage collect
     process.nextTick(gc);
   },
+  observe(callback) {
+    const observer = new PerformanceObserver((list) => {
+      for (const { startTime, duration, detail } of list.getEntries()) {
+        const { kind } = (detail ?? {}) as { kind?: number };
+        callback({ startTime, duration, kind: (kind !== undefined && GC_KINDS[kind]) || "unknown" });
+      }
+    });
+    observer.observe({ entryTypes: ["gc"] });
+    return () => observer.disconnect();
+  },
 });
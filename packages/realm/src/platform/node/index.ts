@@ -21,6 +21,7 @@ import "./fs";
 import "./device-info";
 import "./sync-proxy-config";
 import "./garbage-collection";
+import "./async-context";
 
 import { Realm } from "../../Realm";
 export = Realm;
@@ -67,4 +67,16 @@ inject({
     debug("removeRealmFilesFromDirectory", path);
     JsPlatformHelpers.removeRealmFilesFromDirectory(path);
   },
+  removeFileAsync(path) {
+    debug("removeFileAsync", path);
+    return JsPlatformHelpers.removeFileAsync(path);
+  },
+  removeDirectoryAsync(path) {
+    debug("removeDirectoryAsync", path);
+    return JsPlatformHelpers.removeDirectoryAsync(path);
+  },
+  removeRealmFilesFromDirectoryAsync(path) {
+    debug("removeRealmFilesFromDirectoryAsync", path);
+    return JsPlatformHelpers.removeRealmFilesFromDirectoryAsync(path);
+  },
 });
@@ -19,14 +19,11 @@
 import { binding } from "../binding";
 import { assert } from "../assert";
 import { Dictionary } from "../Dictionary";
-import {
-  createDictionaryAccessor,
-  insertIntoDictionaryOfMixed,
-  isJsOrRealmDictionary,
-} from "../collection-accessors/Dictionary";
+import { createDictionaryAccessor, isJsOrRealmDictionary } from "../collection-accessors/Dictionary";
 import { List } from "../List";
-import { createListAccessor, insertIntoListOfMixed, isJsOrRealmList } from "../collection-accessors/List";
+import { createListAccessor, isJsOrRealmList } from "../collection-accessors/List";
 import { createDefaultPropertyAccessor } from "./default";
+import { flattenMixedTree } from "./mixed-tree";
 import type { PropertyAccessor, PropertyOptions } from "./types";
 
 /** @internal */
@@ -61,14 +58,9 @@ export function createMixedPropertyAccessor(options: PropertyOptions): PropertyA
     set(obj: binding.Obj, value: unknown) {
       assert.inTransaction(realm);
 
-      if (isJsOrRealmList(value)) {
-        obj.setCollection(columnKey, binding.CollectionType.List);
-        const internal = binding.List.make(realm.internal, obj, columnKey);
-        insertIntoListOfMixed(value, internal, toBinding);
-      } else if (isJsOrRealmDictionary(value)) {
-        obj.setCollection(columnKey, binding.CollectionType.Dictionary);
-        const internal = binding.Dictionary.make(realm.internal, obj, columnKey);
-        insertIntoDictionaryOfMixed(value, internal, toBinding);
+      if (isJsOrRealmList(value) || isJsOrRealmDictionary(value)) {
+        // The whole tree of nested collections is written in a single call
+        binding.JsMixedTree.write(obj, columnKey, flattenMixedTree(value, toBinding));
       } else {
         defaultSet(obj, value);
       }
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+import type { binding } from "../binding";
+import { isJsOrRealmDictionary } from "../collection-accessors/Dictionary";
+import { isJsOrRealmList } from "../collection-accessors/List";
+import type { TypeHelpers } from "../TypeHelpers";
+
+/**
+ * The kinds of nodes in a `binding.MixedTree`, matching `JsMixedTree::NodeKind`.
+ */
+enum NodeKind {
+  Value = 0,
+  List = 1,
+  Dictionary = 2,
+}
+
+/**
+ * Flatten a tree of JS values, arrays and objects into a single `binding.MixedTree`,
+ * for nested collections to be written to a mixed property in one call.
+ * @internal
+ */
+export function flattenMixedTree(value: unknown, toBinding: TypeHelpers["toBinding"]): binding.MixedTree {
+  const tree: binding.MixedTree = { shape: [], keys: [], values: [] };
+  const visit = (node: unknown) => {
+    if (isJsOrRealmList(node)) {
+      const items = Array.isArray(node) ? node : [...node];
+      tree.shape.push(NodeKind.List, items.length);
+      for (const item of items) {
+        visit(item);
+      }
+    } else if (isJsOrRealmDictionary(node)) {
+      const keys = Object.keys(node);
+      tree.shape.push(NodeKind.Dictionary, keys.length);
+      for (const key of keys) {
+        tree.keys.push(key);
+        visit(node[key]);
+      }
+    } else {
+      tree.shape.push(NodeKind.Value);
+      tree.values.push(toBinding(node));
+    }
+  };
+  visit(value);
+  return tree;
+}
+
+/**
+ * Build plain JS values, arrays and objects from a `binding.MixedTree` read from a mixed property.
+ * @internal
+ */
+export function expandMixedTree(
+  { shape, keys, values }: binding.MixedTree,
+  fromBinding: TypeHelpers["fromBinding"],
+): unknown {
+  let shapeIndex = 0;
+  let keyIndex = 0;
+  let valueIndex = 0;
+  const next = (): unknown => {
+    const kind = shape[shapeIndex++];
+    if (kind === NodeKind.Value) {
+      return fromBinding(values[valueIndex++]);
+    }
+    const count = shape[shapeIndex++];
+    if (kind === NodeKind.List) {
+      const list = new Array(count);
+      for (let i = 0; i < count; i++) {
+        list[i] = next();
+      }
+      return list;
+    }
+    const dictionary: Record<string, unknown> = {};
+    for (let i = 0; i < count; i++) {
+      const key = keys[keyIndex++];
+      dictionary[key] = next();
+    }
+    return dictionary;
+  };
+  return next();
+}
@@ -27,6 +27,11 @@ declare function setTimeout<Args extends unknown[]>(
 ): Timer;
 declare function clearTimeout(timer: Timer): void;
 
+/** Available on Node.js and React Native. */
+declare const performance: {
+  now(): number;
+};
+
 declare interface Console {
   log(...args: unknown[]): void;
   warn(...args: unknown[]): void;
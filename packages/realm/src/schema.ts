@@ -16,6 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
+export * from "./schema/fingerprint";
 export * from "./schema/from-binding";
 export * from "./schema/to-binding";
 export * from "./schema/normalize";
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { binding } from "../binding";
+import { fromBindingRealmSchema } from "./from-binding";
+import type { CanonicalObjectSchema } from "./types";
+
+/** @internal */
+export const SCHEMA_FINGERPRINT_SUFFIX = ".fingerprint";
+
+/**
+ * Bumped whenever the serialization below changes, to invalidate fingerprints stored by earlier versions.
+ */
+const FINGERPRINT_FORMAT = 1;
+
+/**
+ * Serializes the parts of a normalized schema which end up in the Realm file, in a stable order.
+ * Constructors, defaults and presentations only affect the SDK and are left out.
+ */
+function serializeSchema(schema: CanonicalObjectSchema[]): string {
+  const objectSchemas = [...schema]
+    .sort((a, b) => (a.name < b.name ? -1 : a.name > b.name ? 1 : 0))
+    .map(({ name, primaryKey, embedded, asymmetric, properties }) => [
+      name,
+      primaryKey,
+      embedded,
+      asymmetric,
+      Object.keys(properties)
+        .sort()
+        .map((key) => {
+          const { name, type, objectType, optional, indexed, mapTo, property } = properties[key];
+          return [name, type, objectType, optional, indexed, mapTo, property];
+        }),
+    ]);
+  return JSON.stringify(objectSchemas);
+}
+
+/**
+ * Describes the columns of an object type, by the name of the column in the file, in a stable order. Linking objects
+ * properties are left out, as they aren't stored in the file.
+ */
+function describeColumns({ primaryKey, properties }: CanonicalObjectSchema): string {
+  const columns = Object.values(properties)
+    .filter(({ type }) => type !== "linkingObjects")
+    .sort((a, b) => (a.mapTo < b.mapTo ? -1 : a.mapTo > b.mapTo ? 1 : 0))
+    .map(({ mapTo, type, objectType, optional }) => [mapTo, type, objectType ?? null, optional]);
+  return JSON.stringify([primaryKey ?? null, columns]);
+}
+
+/**
+ * A 64-bit non-cryptographic hash (cyrb53 extended to both halves), as a hex string.
+ */
+function hashString(value: string): string {
+  let h1 = 0xdeadbeef;
+  let h2 = 0x41c6ce57;
+  for (let i = 0; i < value.length; i++) {
+    const code = value.charCodeAt(i);
+    h1 = Math.imul(h1 ^ code, 2654435761);
+    h2 = Math.imul(h2 ^ code, 1597334677);
+  }
+  h1 = Math.imul(h1 ^ (h1 >>> 16), 2246822507);
+  h1 ^= Math.imul(h2 ^ (h2 >>> 13), 3266489909);
+  h2 = Math.imul(h2 ^ (h2 >>> 16), 2246822507);
+  h2 ^= Math.imul(h1 ^ (h1 >>> 13), 3266489909);
+  return (h2 >>> 0).toString(16).padStart(8, "0") + (h1 >>> 0).toString(16).padStart(8, "0");
+}
+
+/**
+ * The fingerprint of a schema and schema version, which is stored next to the Realm file once it was opened with
+ * them. Opening the Realm again with a matching fingerprint can skip passing the schema to the binding.
+ * @internal
+ */
+export class SchemaFingerprint {
+  public readonly value: string;
+  private readonly path: string;
+
+  constructor(
+    realmPath: string,
+    public readonly schema: CanonicalObjectSchema[],
+    public readonly schemaVersion: number,
+  ) {
+    const serialized = serializeSchema(schema);
+    this.value = `${FINGERPRINT_FORMAT}:${schemaVersion}:${serialized.length}:${hashString(serialized)}`;
+    this.path = realmPath + SCHEMA_FINGERPRINT_SUFFIX;
+  }
+
+  /**
+   * @returns `true` if the fingerprint stored next to the Realm file matches this one.
+   */
+  isStored(): boolean {
+    return binding.JsSchemaFingerprint.read(this.path) === this.value;
+  }
+
+  /**
+   * Checks that the Realm has the schema version and exactly the object types and columns of the schema. Guards
+   * against fingerprints which got stale, because the file was replaced, deleted or changed by another process,
+   * such as an app which doesn't use fingerprints, even when that kept the schema version.
+   */
+  matches(internal: binding.Realm): boolean {
+    if (binding.Int64.intToNum(internal.schemaVersion) !== this.schemaVersion) {
+      return false;
+    }
+    const fileSchema = fromBindingRealmSchema(internal.schema);
+    if (fileSchema.length !== this.schema.length) {
+      return false;
+    }
+    const columns = new Map(this.schema.map((objectSchema) => [objectSchema.name, describeColumns(objectSchema)]));
+    return fileSchema.every((objectSchema) => columns.get(objectSchema.name) === describeColumns(objectSchema));
+  }
+
+  /**
+   * Stores the fingerprint, if the Realm was opened with exactly this schema. Failing to store it, e.g. next to a
+   * read-only Realm, only means that the next open takes the regular path.
+   */
+  store(internal: binding.Realm): void {
+    if (!this.matches(internal)) {
+      return;
+    }
+    try {
+      binding.JsSchemaFingerprint.write(this.path, this.value);
+    } catch {
+      // Ignored, see above
+    }
+  }
+}
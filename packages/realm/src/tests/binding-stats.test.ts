@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+
+import { binding } from "../binding";
+import { Realm } from "../Realm";
+import { generateTempRealmPath } from "./utils";
+
+describe("binding stats", () => {
+  beforeEach(() => {
+    binding.resetStats();
+  });
+
+  afterEach(() => {
+    binding.setStatsEnabled(false);
+    binding.resetStats();
+  });
+
+  it("records nothing while disabled", () => {
+    const realm = new Realm({ path: generateTempRealmPath() });
+    try {
+      realm.write(() => {});
+    } finally {
+      realm.close();
+    }
+    expect(binding.stats()).deep.equals({});
+  });
+
+  it("records calls while enabled", () => {
+    binding.setStatsEnabled(true);
+    const realm = new Realm({ path: generateTempRealmPath() });
+    try {
+      realm.write(() => {});
+      realm.write(() => {});
+    } finally {
+      realm.close();
+    }
+    const { RealmMetrics_begin_transaction: stats } = binding.stats();
+    expect(stats.calls).equals(2);
+    expect(stats.totalMs).greaterThan(0);
+    expect(stats.histogram.reduce((sum, count) => sum + count, 0)).equals(2);
+  });
+
+  it("can be reset", () => {
+    binding.setStatsEnabled(true);
+    binding.Timestamp.fromDate(new Date());
+    expect(Object.keys(binding.stats())).not.empty;
+    binding.resetStats();
+    expect(binding.stats()).deep.equals({});
+  });
+});
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+import fs from "node:fs";
+
+import { Realm } from "../Realm";
+import { defaultLogger, defaultLoggerLevel } from "../Logger";
+import { generateTempRealmPath } from "./utils";
+
+async function waitForFile(path: string, predicate: (contents: string) => boolean) {
+  // The log entries are written from a background thread
+  for (let attempt = 0; attempt < 100; attempt++) {
+    if (fs.existsSync(path)) {
+      const contents = fs.readFileSync(path, "utf8");
+      if (predicate(contents)) {
+        return contents;
+      }
+    }
+    await new Promise((resolve) => setTimeout(resolve, 10));
+  }
+  throw new Error(`Timed out waiting for '${path}'`);
+}
+
+describe("native log sinks", () => {
+  afterEach(() => {
+    Realm.setLogger(defaultLogger);
+    Realm.setLogLevel(defaultLoggerLevel);
+  });
+
+  it("writes text lines to a file", async () => {
+    const logPath = generateTempRealmPath() + ".log";
+    Realm.setLogger({ type: "file", path: logPath });
+    Realm.setLogLevel("debug");
+    new Realm({ path: generateTempRealmPath() }).close();
+
+    const contents = await waitForFile(logPath, (contents) => contents.includes("\n"));
+    const [firstLine] = contents.split("\n");
+    expect(firstLine).matches(/^\d{4}-\d\d-\d\dT\d\d:\d\d:\d\d\.\d{3}Z \[Realm[.\w]*\] (debug|detail|info): /);
+  });
+
+  it("writes JSON lines to a file", async () => {
+    const logPath = generateTempRealmPath() + ".log";
+    Realm.setLogger({ type: "file", path: logPath, format: "json" });
+    Realm.setLogLevel("debug");
+    new Realm({ path: generateTempRealmPath() }).close();
+
+    const contents = await waitForFile(logPath, (contents) => contents.includes("\n"));
+    const entry = JSON.parse(contents.split("\n")[0]);
+    expect(entry).has.keys("time", "category", "level", "message");
+    expect(entry.category).to.match(/^Realm/);
+  });
+
+  it("rotates the file", async () => {
+    const logPath = generateTempRealmPath() + ".log";
+    Realm.setLogger({ type: "file", path: logPath, maxFileSize: 256, maxFiles: 2 });
+    Realm.setLogLevel("all");
+    for (let i = 0; i < 5; i++) {
+      new Realm({ path: generateTempRealmPath() }).close();
+    }
+
+    await waitForFile(logPath + ".2", (contents) => contents.length > 0);
+    expect(fs.existsSync(logPath + ".3")).equals(false);
+  });
+
+  it("respects per category log levels", async () => {
+    const logPath = generateTempRealmPath() + ".log";
+    Realm.setLogger({ type: "file", path: logPath, format: "json" });
+    Realm.setLogLevel({ Realm: "off", "Realm.Storage": "debug" });
+    new Realm({ path: generateTempRealmPath() }).close();
+
+    const contents = await waitForFile(logPath, (contents) => contents.includes("\n"));
+    const categories = contents
+      .split("\n")
+      .filter(Boolean)
+      .map((line) => JSON.parse(line).category);
+    for (const category of categories) {
+      expect(category).to.match(/^Realm\.Storage/);
+    }
+  });
+
+  it("throws on an unexpected sink", () => {
+    // @ts-expect-error Testing an invalid sink
+    expect(() => Realm.setLogger({ type: "syslog" })).throws("Unexpected log sink type: 'syslog'");
+  });
+});
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+import { expect } from "chai";
+
+import { binding } from "../binding";
+import { Realm } from "../Realm";
+import { generateTempRealmPath } from "./utils";
+
+
+describe("string interning", () => {
+  let realm: Realm;
+
+  beforeEach(() => {
+    realm = new Realm({
+      path: generateTempRealmPath(),
+      schema: [{ name: "Item", properties: { status: "string", description: "string" } }],
+    });
+    realm.write(() => {
+      for (let i = 0; i < 10; i++) {
+        realm.create("Item", { status: i % 2 ? "open" : "closed", description: "x".repeat(100) });
+      }
+    });
+  });
+
+  afterEach(() => {
+    Realm.setStringInternCapacity(0);
+    realm.close();
+  });
+
+  function readAll(property: string) {
+    return realm.objects<Record<string, string>>("Item").map((item) => item[property]);
+  }
+
+  it("is disabled by default", () => {
+    expect(readAll("status").slice(0, 2)).deep.equals(["closed", "open"]);
+    expect(binding.getStringInternStats()).deep.equals({ capacity: 0, size: 0, hits: 0, misses: 0 });
+  });
+
+  it("reuses strings read before", () => {
+    Realm.setStringInternCapacity(16);
+    expect(readAll("status").slice(0, 2)).deep.equals(["closed", "open"]);
+    const { capacity, size, hits, misses } = binding.getStringInternStats();
+    expect(capacity).equals(16);
+    expect(size).equals(misses);
+    expect(hits).greaterThanOrEqual(8);
+    expect(misses).lessThan(hits);
+  });
+
+  it("skips long strings", () => {
+    Realm.setStringInternCapacity(16);
+    expect(readAll("description").every((description) => description.length === 100)).equals(true);
+    expect(binding.getStringInternStats().size).equals(0);
+  });
+
+  it("evicts the least recently read strings", () => {
+    Realm.setStringInternCapacity(1);
+    readAll("status");
+    const { size, misses } = binding.getStringInternStats();
+    expect(size).equals(1);
+    expect(misses).greaterThanOrEqual(10);
+  });
+
+  it("keeps strings across changes of the capacity", () => {
+    Realm.setStringInternCapacity(1);
+    expect(readAll("status")).has.length(10);
+    Realm.setStringInternCapacity(4);
+    expect(readAll("status").slice(0, 2)).deep.equals(["closed", "open"]);
+    Realm.setStringInternCapacity(1);
+    expect(readAll("status").slice(0, 2)).deep.equals(["closed", "open"]);
+    expect(binding.getStringInternStats().size).equals(1);
+  });
+
+  it("rejects negative capacities natively", () => {
+    expect(() => binding.setStringInternCapacity(-1)).throws("expected a non-negative capacity");
+  });
+
+  it("throws on invalid capacities", () => {
+    expect(() => Realm.setStringInternCapacity(-1)).throws("Expected 'capacity' to be non-negative");
+    expect(() => Realm.setStringInternCapacity(1.5)).throws("Expected 'capacity' to be an integer");
+  });
+});